@@ -0,0 +1,47 @@
+/*
+Generates src/combWFtab.h, the precomputed SID 8580 combined waveform
+tables. Run "make" in this directory after changing the parameters
+in createCombinedWFs() (combWFgen.c).
+*/
+
+#define COMBWF_GENERATOR
+#include "../src/combWFgen.c"
+
+#include <stdio.h>
+
+static int trisaw[4096], pulsesaw[4096], pulsetrisaw[4096], pulsetri[8192];
+
+static void dump(FILE *f, const char *name, const int *table, int size)
+{
+	fprintf(f, "int %s[%d] = {", name, size);
+	
+	for (int i = 0 ; i < size ; ++i)
+		fprintf(f, "%s%d%s", (i % 16) == 0 ? "\n\t" : "", table[i], i < size - 1 ? "," : "");
+	
+	fprintf(f, "\n};\n\n");
+}
+
+int main(int argc, char **argv)
+{
+	FILE *f = argc > 1 ? fopen(argv[1], "w") : stdout;
+	
+	if (!f)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+	
+	fprintf(f, "/* Generated by combwf-tool from combWFgen.c -- do not edit */\n\n");
+	
+	createCombinedWFs(trisaw, pulsesaw, pulsetrisaw, pulsetri);
+	
+	dump(f, "TriSaw_8580", trisaw, 4096);
+	dump(f, "PulseSaw_8580", pulsesaw, 4096);
+	dump(f, "PulseTriSaw_8580", pulsetrisaw, 4096);
+	dump(f, "PulseTri_8580", pulsetri, 8192);
+	
+	if (f != stdout)
+		fclose(f);
+	
+	return 0;
+}
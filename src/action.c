@@ -25,6 +25,7 @@ OTHER DEALINGS IN THE SOFTWARE.
 
 #include "action.h"
 #include "optimize.h"
+#include "usage.h"
 #include "mused.h"
 #include "gui/toolutil.h"
 #include "view.h"
@@ -40,7 +41,9 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include <stdbool.h>
 #include "gui/mouse.h"
 #include "view/wavetableview.h"
+#include "wave_action.h"
 #include "help.h"
+#include "dspload.h"
 #include <string.h>
 
 extern Mused mused;
@@ -189,6 +192,7 @@ void play(void *from_cursor, void *unused1, void *unused2)
 {
 	int pos = from_cursor ? mused.current_sequencepos : 0;
 	mused.play_start_at = get_playtime_at(pos);
+	dl_reset();
 	enable_callback(true);
 	mus_set_song(&mused.mus, &mused.song, pos);
 	mused.flags |= SONG_PLAYING;
@@ -284,11 +288,8 @@ void kill_instrument(void *unused1, void *unused2, void *unused3)
 void generic_action(void *func, void *unused1, void *unused2)
 {
 	mus_set_song(&mused.mus, NULL, 0);
-	cyd_lock(&mused.cyd, 1);
 
 	((void *(*)(void))func)(); /* I love the smell of C in the morning */
-
-	cyd_lock(&mused.cyd, 0);
 }
 
 
@@ -703,6 +704,8 @@ void export_channels_action(void *a, void*b, void*c)
 	{
 		strncpy(mused.previous_export_filename, filename, sizeof(mused.previous_export_filename) - 1);
 
+		FILE *f[MUS_MAX_CHANNELS] = { NULL };
+
 		for (int i = 0 ; i < mused.song.num_channels ; ++i)
 		{
 			char c_filename[1500], tmp[1000];
@@ -721,13 +724,33 @@ void export_channels_action(void *a, void*b, void*c)
 
 			debug("Exporting channel %d to %s", i, c_filename);
 
-			FILE *f = fopen(c_filename, "wb");
+			f[i] = fopen(c_filename, "wb");
+		}
 
-			if (f)
-			{
-				export_wav(&mused.song, mused.mus.cyd->wavetable_entries, f, i);
-				// f is closed inside of export_wav (inside of ww_finish)
-			}
+		export_channels(&mused.song, mused.mus.cyd->wavetable_entries, f, mused.song.num_channels);
+		// files are closed inside of export_channels (inside of ww_finish)
+	}
+}
+
+
+void export_dsp_load_action(void *a, void*b, void*c)
+{
+	char def[1000];
+
+	snprintf(def, sizeof(def), "%s-dspload.csv", mused.song.title);
+
+	char filename[5000];
+
+	if (open_dialog_fn("wb", "Export DSP load", "csv", domain, mused.slider_bevel, &mused.largefont, &mused.smallfont, def, filename, sizeof(filename)))
+	{
+		FILE *f = fopen(filename, "wb");
+
+		if (f)
+		{
+			if (!dl_export(f, mused.song.title))
+				set_info_message("Could not write %s", filename);
+
+			fclose(f);
 		}
 	}
 }
@@ -736,6 +759,9 @@ void export_channels_action(void *a, void*b, void*c)
 
 void do_undo(void *a, void*b, void*c)
 {
+	// A pencil stroke still in progress has to be on the stack first
+	wavetable_draw_end();
+
 	UndoFrame *frame = a ? undo(&mused.redo) : undo(&mused.undo);
 
 	debug("%s frame %p", a ? "Redo" : "Undo", frame);
@@ -756,8 +782,10 @@ void do_undo(void *a, void*b, void*c)
 		case UNDO_PATTERN:
 			undo_store_pattern(&mused.undo, frame->event.pattern.idx, &mused.song.pattern[frame->event.pattern.idx], mused.modified);
 
-			resize_pattern(&mused.song.pattern[frame->event.pattern.idx], frame->event.pattern.n_steps);
-			memcpy(mused.song.pattern[frame->event.pattern.idx].step, frame->event.pattern.step, frame->event.pattern.n_steps * sizeof(frame->event.pattern.step[0]));
+			// The stored steps are handed over as they are, the frame is destroyed below
+
+			swap_pattern_steps(&mused.song.pattern[frame->event.pattern.idx], frame->event.pattern.step, frame->event.pattern.n_steps);
+			frame->event.pattern.step = NULL;
 			break;
 
 		case UNDO_SEQUENCE:
@@ -765,9 +793,7 @@ void do_undo(void *a, void*b, void*c)
 
 			undo_store_sequence(&mused.undo, mused.current_sequencetrack, mused.song.sequence[mused.current_sequencetrack], mused.song.num_sequences[mused.current_sequencetrack], mused.modified);
 
-			mused.song.num_sequences[mused.current_sequencetrack] = frame->event.sequence.n_seq;
-
-			memcpy(mused.song.sequence[mused.current_sequencetrack], frame->event.sequence.seq, frame->event.sequence.n_seq * sizeof(frame->event.sequence.seq[0]));
+			set_sequence(mused.current_sequencetrack, frame->event.sequence.seq, frame->event.sequence.n_seq);
 			break;
 
 		case UNDO_MODE:
@@ -780,7 +806,9 @@ void do_undo(void *a, void*b, void*c)
 
 			undo_store_instrument(&mused.undo, mused.current_instrument, &mused.song.instrument[mused.current_instrument], mused.modified);
 
+			cyd_lock(&mused.cyd, 1);
 			memcpy(&mused.song.instrument[mused.current_instrument], &frame->event.instrument.instrument, sizeof(frame->event.instrument.instrument));
+			cyd_lock(&mused.cyd, 0);
 
 			break;
 
@@ -789,9 +817,11 @@ void do_undo(void *a, void*b, void*c)
 
 			undo_store_fx(&mused.undo, mused.fx_bus, &mused.song.fx[mused.fx_bus], mused.song.multiplex_period, mused.modified);
 
+			cyd_lock(&mused.cyd, 1);
 			memcpy(&mused.song.fx[mused.fx_bus], &frame->event.fx.fx, sizeof(frame->event.fx.fx));
 			mused.song.multiplex_period = frame->event.fx.multiplex_period;
 			mus_set_fx(&mused.mus, &mused.song);
+			cyd_lock(&mused.cyd, 0);
 			break;
 
 		case UNDO_SONGINFO:
@@ -799,6 +829,8 @@ void do_undo(void *a, void*b, void*c)
 			undo_store_songinfo(&mused.undo, &mused.song, mused.modified);
 
 			MusSong *song = &mused.song;
+
+			cyd_lock(&mused.cyd, 1);
 			song->song_length = frame->event.songinfo.song_length;
 			mused.sequenceview_steps = song->sequence_step = frame->event.songinfo.sequence_step;
 			song->loop_point = frame->event.songinfo.loop_point;
@@ -812,6 +844,7 @@ void do_undo(void *a, void*b, void*c)
 			song->master_volume = frame->event.songinfo.master_volume;
 			memcpy(song->default_volume, frame->event.songinfo.default_volume, sizeof(frame->event.songinfo.default_volume));
 			memcpy(song->default_panning, frame->event.songinfo.default_panning, sizeof(frame->event.songinfo.default_panning));
+			cyd_lock(&mused.cyd, 0);
 		}
 		break;
 
@@ -822,12 +855,15 @@ void do_undo(void *a, void*b, void*c)
 			undo_store_wave_param(&mused.undo, mused.selected_wavetable, &mused.mus.cyd->wavetable_entries[mused.selected_wavetable], mused.modified);
 
 			CydWavetableEntry *entry = &mused.mus.cyd->wavetable_entries[mused.selected_wavetable];
+
+			cyd_lock(&mused.cyd, 1);
 			entry->flags = frame->event.wave_param.flags;
 			entry->sample_rate = frame->event.wave_param.sample_rate;
 			entry->samples = frame->event.wave_param.samples;
 			entry->loop_begin = frame->event.wave_param.loop_begin;
 			entry->loop_end = frame->event.wave_param.loop_end;
 			entry->base_note = frame->event.wave_param.base_note;
+			cyd_lock(&mused.cyd, 0);
 		}
 		break;
 
@@ -838,20 +874,72 @@ void do_undo(void *a, void*b, void*c)
 			undo_store_wave_data(&mused.undo, mused.selected_wavetable, &mused.mus.cyd->wavetable_entries[mused.selected_wavetable], mused.modified);
 
 			CydWavetableEntry *entry = &mused.mus.cyd->wavetable_entries[mused.selected_wavetable];
-			entry->data = realloc(entry->data, frame->event.wave_data.length * sizeof(entry->data[0]));
-			memcpy(entry->data, frame->event.wave_data.data, frame->event.wave_data.length * sizeof(entry->data[0]));
-			entry->samples = frame->event.wave_data.length;
+			Sint16 *old = entry->data;
+
+			// The stored buffer is handed over like above
+
+			cyd_lock(&mused.cyd, 1);
+			entry->data = frame->event.wave_data.data;
 			entry->sample_rate = frame->event.wave_data.sample_rate;
 			entry->samples = frame->event.wave_data.samples;
 			entry->loop_begin = frame->event.wave_data.loop_begin;
 			entry->loop_end = frame->event.wave_data.loop_end;
 			entry->flags = frame->event.wave_data.flags;
 			entry->base_note = frame->event.wave_data.base_note;
+			cyd_lock(&mused.cyd, 0);
+
+			frame->event.wave_data.data = NULL;
+			free(old);
 
 			invalidate_wavetable_view();
 		}
 		break;
 
+		case UNDO_WAVE_RANGE:
+		{
+			mused.selected_wavetable = frame->event.wave_range.idx;
+
+			CydWavetableEntry *entry = &mused.mus.cyd->wavetable_entries[mused.selected_wavetable];
+			const int first = frame->event.wave_range.first, length = frame->event.wave_range.length;
+
+			if (first + length <= entry->samples)
+			{
+				undo_store_wave_range(&mused.undo, mused.selected_wavetable, first, length, &entry->data[first], mused.modified);
+
+				cyd_lock(&mused.cyd, 1);
+				memcpy(&entry->data[first], frame->event.wave_range.data, length * sizeof(entry->data[0]));
+				cyd_lock(&mused.cyd, 0);
+
+				invalidate_wavetable_range(first, first + length);
+			}
+		}
+		break;
+
+		case UNDO_WAVE_BATCH:
+		{
+			const int first = frame->event.wave_batch.first, count = frame->event.wave_batch.count;
+
+			undo_store_wave_batch(&mused.undo, first, count, &mused.mus.cyd->wavetable_entries[first], mused.modified);
+
+			// The stored buffers are handed over as they are, the frame is destroyed below
+
+			cyd_lock(&mused.cyd, 1);
+
+			for (int i = 0 ; i < count ; ++i)
+			{
+				CydWavetableEntry *entry = &mused.mus.cyd->wavetable_entries[first + i];
+
+				free(entry->data);
+				*entry = frame->event.wave_batch.entry[i];
+				frame->event.wave_batch.entry[i].data = NULL;
+			}
+
+			cyd_lock(&mused.cyd, 0);
+
+			invalidate_wavetable_items(first, count);
+		}
+		break;
+
 		case UNDO_WAVE_NAME:
 		{
 			mused.selected_wavetable = frame->event.wave_name.idx;
@@ -867,6 +955,8 @@ void do_undo(void *a, void*b, void*c)
 		default: warning("Undo type %d not handled", frame->type); break;
 	}
 
+	usage_invalidate();
+
 	mused.modified = frame->modified;
 
 	if (!a)
@@ -891,7 +981,9 @@ void do_undo(void *a, void*b, void*c)
 void kill_wavetable_entry(void *a, void*b, void*c)
 {
 	snapshot(S_T_WAVE_DATA);
+	cyd_lock(&mused.cyd, 1);
 	cyd_wave_entry_init(&mused.mus.cyd->wavetable_entries[mused.selected_wavetable], NULL, 0, 0, 0, 0, 0);
+	cyd_lock(&mused.cyd, 0);
 }
 
 
@@ -953,14 +1045,6 @@ void change_visualizer_action(void *vis, void *unused1, void *unused2)
 
 
 void open_help(void *unused0, void *unused1, void *unused2)
-{
-	cyd_lock(&mused.cyd, 0);
-	open_help_no_lock(NULL, NULL, NULL);
-	cyd_lock(&mused.cyd, 1);
-}
-
-
-void open_help_no_lock(void *unused0, void *unused1, void *unused2)
 {
 	helpbox("Help", domain, mused.slider_bevel, &mused.largefont, &mused.smallfont);
 }
@@ -72,6 +72,7 @@ void load_keymap_action(void *a, void*b, void*c);
 void unmute_all_action(void*, void*, void*);
 void export_wav_action(void *a, void*b, void*c);
 void export_channels_action(void *a, void*b, void*c);
+void export_dsp_load_action(void *a, void*b, void*c);
 void open_data(void *type, void*b, void*c);
 void do_undo(void *stack, void*b, void*c);
 void kill_wavetable_entry(void *a, void*b, void*c);
@@ -80,7 +81,6 @@ void flip_bit_action(void *bits, void *mask, void *);
 void set_note_jump(void *steps, void *, void *);
 void change_visualizer_action(void *vis, void *unused1, void *unused2);
 void open_help(void *unused0, void *unused1, void *unused2);
-void open_help_no_lock(void *unused0, void *unused1, void *unused2);
 void change_oversample(void *oversample, void *unused1, void *unused2);
 void toggle_follow_play_position(void *unused1, void *unused2, void *unused3);
 void toggle_visualizer(void *unused1, void *unused2, void *unused3);
@@ -0,0 +1,63 @@
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "audioring.h"
+#include <string.h>
+
+void ar_init(AudioRing *ring)
+{
+	memset(ring->data, 0, sizeof(ring->data));
+	SDL_AtomicSet(&ring->write_pos, 0);
+	SDL_AtomicSet(&ring->read_ticks, SDL_GetTicks() - AR_IDLE);
+}
+
+
+void ar_push_stereo(AudioRing *ring, const Sint16 *frames, int count)
+{
+	if ((Uint32)(SDL_GetTicks() - (Uint32)SDL_AtomicGet(&ring->read_ticks)) > AR_IDLE)
+		return;
+	
+	unsigned int pos = SDL_AtomicGet(&ring->write_pos);
+	
+	for (int i = 0 ; i < count ; ++i, ++pos, frames += 2)
+		ring->data[pos & (AR_SIZE - 1)] = ((int)frames[0] + frames[1]) / 2;
+	
+	// Samples have to be visible before the new position
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(&ring->write_pos, pos);
+}
+
+
+void ar_read(const AudioRing *ring, float *dest, int count)
+{
+	SDL_AtomicSet((SDL_atomic_t*)&ring->read_ticks, SDL_GetTicks());
+	
+	const unsigned int pos = SDL_AtomicGet((SDL_atomic_t*)&ring->write_pos) - count;
+	
+	SDL_MemoryBarrierAcquire();
+	
+	for (int i = 0 ; i < count ; ++i)
+		dest[i] = ring->data[(pos + i) & (AR_SIZE - 1)] * (1.0f / 32768);
+}
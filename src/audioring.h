@@ -0,0 +1,58 @@
+#ifndef AUDIORING_H
+#define AUDIORING_H
+
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SDL.h"
+
+/*
+Lock-free ring of the most recent output samples for the visualizers. The
+audio thread writes and never waits, the UI copies the latest window out
+whenever it draws. If the writer laps the reader mid-copy the window just
+gets a few newer samples, which is fine for display.
+
+The writer skips its copy when nobody has read the ring for AR_IDLE ms, so
+a hidden visualizer costs a timer read per buffer. The first frame drawn
+after that shows old samples.
+*/
+
+#define AR_SIZE 8192 // must be a power of two and at least twice the read window
+#define AR_IDLE 500 // ms
+
+typedef struct
+{
+	Sint16 data[AR_SIZE];
+	SDL_atomic_t write_pos; // written by the audio thread only
+	SDL_atomic_t read_ticks; // SDL_GetTicks() of the latest ar_read()
+} AudioRing;
+
+void ar_init(AudioRing *ring);
+/* Audio thread, mixes interleaved stereo frames to mono */
+void ar_push_stereo(AudioRing *ring, const Sint16 *frames, int count);
+/* Copies the count latest samples (oldest first) scaled to -1..1 */
+void ar_read(const AudioRing *ring, float *dest, int count);
+
+#endif
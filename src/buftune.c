@@ -0,0 +1,249 @@
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "buftune.h"
+#include "dspload.h"
+#include "mused.h"
+#include <string.h>
+#include <stdio.h>
+
+extern Mused mused;
+
+static struct
+{
+	Uint32 device;
+	int size; // kept apart from mused.mix_buffer which is what the user set
+	int failed; // largest size that glitched, 0 = none
+	int calm;
+	bool stopped; // device could not be reopened
+	Uint32 last_check;
+	Uint32 buffers, xruns, resets;
+} tune;
+
+
+static Uint32 device_hash()
+{
+	// dl_register() opens the default output which need not be device 0,
+	// without SDL_GetDefaultAudioInfo() only the driver tells devices apart
+	
+	char *device = NULL;
+	
+#if SDL_VERSION_ATLEAST(2, 24, 0)
+	SDL_AudioSpec spec;
+	
+	if (SDL_GetDefaultAudioInfo(&device, &spec, 0) != 0)
+		device = NULL;
+#endif
+	
+	const char *names[] = { SDL_GetCurrentAudioDriver(), device ? device : "default" };
+	Uint32 hash = 2166136261u;
+	
+	for (int n = 0 ; n < 2 ; ++n)
+	{
+		for (const char *c = names[n] ; c && *c ; ++c)
+			hash = (hash ^ (Uint8)*c) * 16777619u;
+		
+		hash = (hash ^ ':') * 16777619u;
+	}
+	
+	SDL_free(device);
+	
+	return hash;
+}
+
+
+/* mused.tuned_mix_buffers is a list of "hash:size" items, most recent first */
+
+static int parse_tuned(Uint32 *device, int *size)
+{
+	int count = 0;
+	const char *c = mused.tuned_mix_buffers;
+	
+	while (count < BT_MAX_DEVICES && sscanf(c, "%x:%d", &device[count], &size[count]) == 2)
+	{
+		++count;
+		
+		if (!(c = strchr(c, ',')))
+			break;
+		
+		++c;
+	}
+	
+	return count;
+}
+
+
+static int lookup(Uint32 device)
+{
+	Uint32 devices[BT_MAX_DEVICES];
+	int sizes[BT_MAX_DEVICES];
+	const int count = parse_tuned(devices, sizes);
+	
+	for (int i = 0 ; i < count ; ++i)
+	{
+		if (devices[i] == device)
+			return sizes[i];
+	}
+	
+	return 0;
+}
+
+
+static void remember(Uint32 device, int size)
+{
+	Uint32 devices[BT_MAX_DEVICES];
+	int sizes[BT_MAX_DEVICES];
+	const int count = parse_tuned(devices, sizes);
+	char *c = mused.tuned_mix_buffers;
+	const char *end = mused.tuned_mix_buffers + sizeof(mused.tuned_mix_buffers);
+	
+	c += snprintf(c, end - c, "%08x:%d", device, size);
+	
+	for (int i = 0, n = 1 ; i < count && n < BT_MAX_DEVICES && c < end ; ++i)
+	{
+		if (devices[i] == device)
+			continue;
+		
+		c += snprintf(c, end - c, ",%08x:%d", devices[i], sizes[i]);
+		++n;
+	}
+}
+
+
+static void set_buffer(int size)
+{
+	debug("Mix buffer %d -> %d", tune.size, size);
+	
+	cyd_unregister(&mused.cyd);
+	
+	if (dl_register(&mused.cyd, size))
+		tune.size = size;
+	else if (!dl_register(&mused.cyd, tune.size))
+	{
+		// Neither size opens anymore, go back to what the user configured
+		// and stop tuning for this session
+		
+		tune.stopped = true;
+		tune.size = mused.mix_buffer;
+		
+		if (dl_register(&mused.cyd, tune.size))
+			set_info_message("Could not reopen audio, mix buffer %d samples", tune.size);
+		else
+			set_info_message("Could not reopen audio device!");
+		
+		return;
+	}
+	
+	// The counters restart from zero once the callback sees the reset
+	
+	tune.calm = 0;
+	tune.buffers = tune.xruns = 0;
+	
+	set_info_message("Mix buffer %d samples", tune.size);
+}
+
+
+int bt_init()
+{
+	memset(&tune, 0, sizeof(tune));
+	
+	if (!mused.auto_mix_buffer)
+		return tune.size = mused.mix_buffer;
+	
+	tune.device = device_hash();
+	
+	const int size = lookup(tune.device);
+	
+	if (size >= BT_MIN && size <= BT_MAX)
+	{
+		// Already explored, don't probe below the stable size again
+		
+		tune.failed = size / 2;
+		return tune.size = size;
+	}
+	
+	return tune.size = BT_START;
+}
+
+
+void bt_update()
+{
+	if (!mused.auto_mix_buffer || tune.stopped)
+		return;
+	
+	const Uint32 now = SDL_GetTicks();
+	
+	if (now - tune.last_check < BT_PERIOD)
+		return;
+	
+	tune.last_check = now;
+	
+	if (tune.device == 0)
+		tune.device = device_hash();
+	
+	const DspLoad *dl = dl_get();
+	const Uint32 resets = dl->resets;
+	const Uint32 buffers = dl->buffers, xruns = dl->xruns;
+	
+	if (resets != tune.resets || resets != dl->resets)
+	{
+		// Counters were cleared (play, reopened device), start over
+		tune.resets = dl->resets;
+		tune.buffers = dl->buffers;
+		tune.xruns = dl->xruns;
+		return;
+	}
+	
+	const Uint32 new_buffers = buffers - tune.buffers, new_xruns = xruns - tune.xruns;
+	
+	tune.buffers = buffers;
+	tune.xruns = xruns;
+	
+	if (new_buffers < 10)
+		return;
+	
+	const int size = dl->buffer_samples;
+	
+	if (new_xruns > 0 || dl->peak > BT_HIGH_LOAD)
+	{
+		tune.failed = my_max(tune.failed, size);
+		
+		if (size < BT_MAX)
+			set_buffer(size * 2);
+		
+		return;
+	}
+	
+	if (++tune.calm < BT_CALM)
+		return;
+	
+	if (tune.calm == BT_CALM)
+		remember(tune.device, size);
+	
+	// Reopening the device drops a buffer so don't do it during playback
+	
+	if (dl->peak < BT_LOW_LOAD && size / 2 >= BT_MIN && size / 2 > tune.failed && !(mused.flags & SONG_PLAYING))
+		set_buffer(size / 2);
+}
@@ -0,0 +1,56 @@
+#ifndef BUFTUNE_H
+#define BUFTUNE_H
+
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SDL.h"
+
+/*
+Automatic mix buffer size. Starts small and doubles the buffer whenever
+the callback misses a deadline or runs close to it, halves it again when
+the load stays low. Sizes that glitched are not tried again during the
+session. A size that has stayed clean for a while is remembered per
+audio device (hash of the driver and default device name) and used from
+the start next time. The configured mix_buffer is only used with the
+automatic size turned off, or after the device can't be reopened with
+either the new or the old size.
+*/
+
+#define BT_MIN 256
+#define BT_MAX 8192
+#define BT_START 512
+#define BT_PERIOD 3000 // ms between decisions
+#define BT_CALM 3 // clean periods before stepping down or remembering
+#define BT_HIGH_LOAD 0.8f
+#define BT_LOW_LOAD 0.3f
+#define BT_MAX_DEVICES 6
+
+/* Buffer size to open the device with */
+int bt_init();
+/* UI thread, once per frame */
+void bt_update();
+
+#endif
@@ -0,0 +1,79 @@
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "cmdqueue.h"
+
+void cq_init(CmdQueue *queue)
+{
+	SDL_AtomicSet(&queue->head, 0);
+	SDL_AtomicSet(&queue->tail, 0);
+}
+
+
+bool cq_push(CmdQueue *queue, const AudioCmd *cmd)
+{
+	const unsigned int head = SDL_AtomicGet(&queue->head);
+	
+	if (head - (unsigned int)SDL_AtomicGet(&queue->tail) >= CQ_SIZE)
+		return false;
+	
+	queue->cmd[head & (CQ_SIZE - 1)] = *cmd;
+	
+	// The slot has to be visible before the new head
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(&queue->head, head + 1);
+	
+	return true;
+}
+
+
+bool cq_pop(CmdQueue *queue, AudioCmd *cmd)
+{
+	const unsigned int tail = SDL_AtomicGet(&queue->tail);
+	
+	if (tail == (unsigned int)SDL_AtomicGet(&queue->head))
+		return false;
+	
+	SDL_MemoryBarrierAcquire();
+	*cmd = queue->cmd[tail & (CQ_SIZE - 1)];
+	
+	SDL_AtomicSet(&queue->tail, tail + 1);
+	
+	return true;
+}
+
+
+bool cq_peek(CmdQueue *queue, AudioCmd *cmd)
+{
+	const unsigned int tail = SDL_AtomicGet(&queue->tail);
+	
+	if (tail == (unsigned int)SDL_AtomicGet(&queue->head))
+		return false;
+	
+	SDL_MemoryBarrierAcquire();
+	*cmd = queue->cmd[tail & (CQ_SIZE - 1)];
+	
+	return true;
+}
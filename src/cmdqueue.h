@@ -0,0 +1,77 @@
+#ifndef CMDQUEUE_H
+#define CMDQUEUE_H
+
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SDL.h"
+#include <stdbool.h>
+
+/*
+Single producer, single consumer queue for commands from the UI thread to
+the audio thread. The producer never blocks and drops a command if the
+queue is full. Untimed queues are drained at the start of every tick and
+every audio buffer, timed ones (see dl_set_timed_queue) split the buffer at
+the arrival time of each command. The consumer runs commands under the
+engine lock.
+*/
+
+#define CQ_SIZE 256 // must be a power of two
+
+typedef enum
+{
+	CQ_NOTE_ON, // polyphonic jamming, remembers the channel for CQ_NOTE_OFF
+	CQ_NOTE_OFF,
+	CQ_TRIGGER, // one-shot on channel (-1 = any)
+	CQ_TRIGGER_WAVE, // param is a wavetable item instead of an instrument
+	CQ_GATE_OFF, // releases all channels
+	CQ_EXT_SYNC // one MIDI clock
+} CqType;
+
+typedef struct
+{
+	Uint8 type;
+	Sint8 channel;
+	Uint16 note;
+	int param; // instrument or wavetable item
+	Uint64 time; // performance counter at arrival, 0 = not timed
+} AudioCmd;
+
+typedef struct
+{
+	AudioCmd cmd[CQ_SIZE];
+	SDL_atomic_t head; // written by the producer only
+	SDL_atomic_t tail; // written by the consumer only
+} CmdQueue;
+
+void cq_init(CmdQueue *queue);
+/* UI thread, returns false if the queue is full */
+bool cq_push(CmdQueue *queue, const AudioCmd *cmd);
+/* Audio thread, returns false if the queue is empty */
+bool cq_pop(CmdQueue *queue, AudioCmd *cmd);
+/* Audio thread, like cq_pop() but leaves the command in the queue */
+bool cq_peek(CmdQueue *queue, AudioCmd *cmd);
+
+#endif
@@ -25,36 +25,17 @@ OTHER DEALINGS IN THE SOFTWARE.
 
 #include "stdlib.h"
 #include "math.h"
+#include "combWFgen.h"
 
-#include "SDL.h"
-#include "gfx/gfx.h"
-#include "snd/music.h"
-#include "gui/toolutil.h"
-#include "copypaste.h"
-#include "diskop.h"
-#include "event.h"
-#include "view.h"
-#include "gui/slider.h"
-#include "action.h"
-#include "gui/mouse.h"
-#include "gui/bevel.h"
-#include "gui/menu.h"
-#include "shortcutdefs.h"
-#include "version.h"
-#include "mused.h"
-#include "config.h"
-#include "mybevdefs.h"
-#include <time.h>
-#include "util/rnd.h"
-#include "view/visu.h"
-#include "view/pattern.h"
-#include "view/sequence.h"
-#include "view/wavetableview.h"
-#include "view/timer.h"
-#include "mymsg.h"
-#include "key.h"
-#include "nostalgy.h"
-#include "theme.h"
+/*
+The tables are computed offline by combwf-tool (see createCombinedWFs() below)
+so startup does not have to run the ~1.7M pow() calls. Regenerate combWFtab.h
+with "make -C combwf-tool" after touching the parameters or the algorithm.
+*/
+
+#ifndef COMBWF_GENERATOR
+#include "combWFtab.h"
+#endif
 
 long map_Arduino(long x, long in_min, long in_max, long out_min, long out_max)
 {
@@ -140,4 +121,12 @@ void createPulseTri(int wfarray[], float bitmul, float bitstrength,float treshol
     /*wfarray[4096 + i] = wfarray[i];
     wfarray[i] = 0;*/
   }
-} 
\ No newline at end of file
+}
+
+void createCombinedWFs(int trisaw[4096], int pulsesaw[4096], int pulsetrisaw[4096], int pulsetri[8192])
+{
+  createCombinedWF(pulsesaw,1.4,1.9,0.68);
+  createCombinedWF(pulsetrisaw,0.8,2.5,0.64); 
+  createCombinedWF(trisaw,0.8,2.4,0.64); 
+  createPulseTri(pulsetri,1.4,1.9,0.68); //createPulseTri(PulseTri_8580,3.1,1.1,0.64);
+}
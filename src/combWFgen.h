@@ -30,4 +30,5 @@ extern int PulseTri_8580[8192];
 
 long map_Arduino(long x, long in_min, long in_max, long out_min, long out_max);
 void createCombinedWF(int wfarray[], float bitmul, float bitstrength,float treshold) ;
-void createPulseTri(int wfarray[], float bitmul, float bitstrength,float treshold) ;
\ No newline at end of file
+void createPulseTri(int wfarray[], float bitmul, float bitstrength,float treshold) ;
+void createCombinedWFs(int trisaw[4096], int pulsesaw[4096], int pulsetrisaw[4096], int pulsetri[8192]);
@@ -0,0 +1,1294 @@
+/* Generated by combwf-tool from combWFgen.c -- do not edit */
+
+int TriSaw_8580[4096] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,241,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,483,514,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,241,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	1935,2903,2903,2903,2903,2903,2903,2933,2903,2903,2903,2903,2903,2903,2963,3008,
+	3386,3386,3386,3386,3386,3386,3386,3417,3628,3628,3628,3628,3749,3749,3810,3855,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,967,967,967,1073,
+	1451,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,483,483,483,514,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,241,241,362,362,423,468,
+	5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5911,
+	5806,5806,5806,5806,5806,5806,5806,5836,5806,5806,5806,5806,5806,5927,5987,6032,
+	6773,6773,6773,6773,6773,6773,6773,6804,6773,6773,6773,6773,6773,6773,6834,6879,
+	7257,7257,7257,7257,7257,7257,7257,7287,7499,7499,7499,7499,7620,7620,7680,7726,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	1451,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,483,514,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,241,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,1935,1935,1935,1935,1935,2056,2116,2162,
+	2903,2903,2903,2903,2903,2903,2903,2933,2903,2903,2903,2903,2903,2903,2963,3008,
+	3386,3386,3386,3386,3386,3386,3386,3417,3628,3628,3628,3628,3749,3749,3810,3855,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,967,967,967,967,967,967,967,1073,
+	1451,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,483,483,483,514,8467,8467,8467,8467,8588,8588,8648,8694,
+	11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11718,
+	11612,11612,11612,11612,11612,11612,11612,11642,11612,11612,11612,11612,11612,11612,11793,11838,
+	11612,11612,11612,11612,11612,11612,11612,11642,11612,11612,11612,11612,11612,11612,11612,11718,
+	11612,11612,11612,11612,11612,11612,11612,11642,11612,11612,11854,11854,11975,11975,12035,12080,
+	13547,13547,13547,13547,13547,13547,13547,13547,13547,13547,13547,13547,13547,13547,13547,13653,
+	13547,13547,13547,13547,13547,13547,13547,13577,13547,13547,13547,13547,13547,13668,13728,13774,
+	14515,14515,14515,14515,14515,14515,14515,14545,14515,14515,14515,14515,14515,14515,14575,14621,
+	14999,14999,14999,14999,14999,14999,14999,15029,15240,15240,15240,15240,15361,15361,15422,15467,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	1451,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,483,514,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,241,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	2903,2903,2903,2903,2903,2903,2903,2933,2903,2903,2903,2903,2903,2903,2963,3008,
+	3386,3386,3386,3386,3386,3386,3386,3417,3628,3628,3628,3628,3749,3749,3810,3855,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,967,967,967,967,1073,
+	1451,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,483,483,483,514,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,3870,3870,3870,3870,3870,3870,3870,3976,
+	3870,3870,3870,3870,3870,3870,3870,3900,3870,3870,4112,4112,4233,4233,4294,4339,
+	5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5911,
+	5806,5806,5806,5806,5806,5806,5806,5836,5806,5806,5806,5806,5806,5927,5987,6032,
+	6773,6773,6773,6773,6773,6773,6773,6804,6773,6773,6773,6773,6773,6773,6834,6879,
+	7257,7257,7257,7257,7257,7257,7257,7287,7499,7499,7499,7499,7620,7620,7680,7726,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	1451,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,483,483,514,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,241,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	1935,1935,1935,1935,1935,1935,1935,1965,1935,1935,1935,1935,1935,2056,2116,2162,
+	2903,2903,2903,2903,2903,2903,2903,2933,2903,2903,2903,2903,2903,2903,2963,3008,
+	3386,3386,3386,3386,3386,3386,3386,3417,3628,3628,3628,3628,3749,3749,3810,3855,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,15482,15482,15482,15482,15482,15482,15482,15588,
+	15482,15482,15482,15482,15482,15482,15482,15513,15482,15482,15482,15482,15482,15482,15664,15709,
+	15482,15482,15482,15482,15482,15482,15482,15513,15482,15482,15482,15482,15482,15482,15482,15588,
+	15482,15482,15482,15482,15482,15482,15482,15513,16208,16208,16208,16208,16329,16329,16390,16435,
+	15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15588,
+	15482,15482,15482,15482,15482,15482,15482,15513,15482,15482,15482,15482,15482,15482,15664,15709,
+	15482,15482,15482,15482,15482,15482,15482,15513,15482,15482,15482,15482,15482,15482,15482,15588,
+	15482,15482,15482,15482,15482,15482,15482,15513,15482,15482,15482,15724,15845,15845,15906,15951,
+	15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15588,
+	15482,15482,15482,15482,15482,15482,15482,15513,15482,15482,15482,15482,15482,15603,15664,15709,
+	15482,15482,15482,15482,15482,15482,15482,15513,16450,16450,16450,16450,16450,16450,16450,16556,
+	16934,16934,16934,16934,16934,16934,16934,16964,17176,17176,17176,17176,17297,17297,17357,17403,
+	54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54295,
+	54190,54190,54190,54190,54190,54190,54190,54220,54190,54190,54190,54190,54190,54190,54371,54416,
+	54190,54190,54190,54190,54190,54190,54190,54220,54190,54190,54190,54190,54190,54190,54190,54295,
+	54190,54190,54190,54190,54190,54190,54190,54220,54190,54190,54190,54190,54552,54552,54613,54658,
+	54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54295,
+	54190,54190,54190,54190,54190,54190,54190,54220,54190,54190,54190,54190,54190,54311,54371,54416,
+	54190,54190,54190,54190,54190,54190,54190,54220,54190,54190,54190,54190,54190,54190,54190,54295,
+	54190,54190,54190,54190,54673,54673,54673,54704,54915,54915,54915,54915,55036,55036,55097,55142,
+	58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58166,
+	58060,58060,58060,58060,58060,58060,58060,58091,58060,58060,58060,58060,58060,58060,58242,58287,
+	58060,58060,58060,58060,58060,58060,58060,58091,58060,58060,58060,58060,58060,58060,58060,58166,
+	58060,58060,58060,58060,58060,58060,58060,58091,58060,58060,58302,58302,58423,58423,58484,58529,
+	59996,59996,59996,59996,59996,59996,59996,59996,59996,59996,59996,59996,59996,59996,59996,60102,
+	59996,59996,59996,59996,59996,59996,59996,60026,59996,59996,59996,59996,59996,60117,60177,60222,
+	60963,60963,60963,60963,60963,60963,60963,60994,60963,60963,60963,60963,60963,60963,61024,61069,
+	61447,61447,61447,61447,61447,61447,61447,61477,61689,61689,61689,61689,61810,61810,61871,61916
+};
+
+int PulseSaw_8580[4096] = {
+	0,0,0,0,0,0,0,45,0,0,0,15,0,0,60,105,
+	0,0,0,15,0,0,0,105,0,0,0,45,120,181,211,226,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,60,211,226,
+	0,0,0,15,0,0,60,105,241,241,362,408,423,423,453,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,362,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,181,211,710,
+	0,483,483,498,725,725,786,831,725,846,846,892,907,922,1905,1920,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,120,181,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,181,211,226,
+	0,0,0,15,0,0,302,831,725,846,846,892,907,922,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,211,226,
+	0,0,0,15,0,0,0,105,0,0,362,408,362,423,1421,1436,
+	0,967,967,982,967,967,967,1557,1451,1451,1451,1496,1572,1632,1663,1678,
+	1451,1451,1693,1738,1693,1693,1784,1799,1814,1814,1814,3795,3810,3825,3840,3855,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,105,
+	0,0,0,15,0,0,0,105,0,0,0,45,120,181,211,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,60,211,226,
+	0,0,0,15,0,0,60,347,241,241,362,892,907,922,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,408,362,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,529,483,665,1663,1678,
+	1451,1451,1451,1708,1693,1693,1753,1799,1693,1814,1814,1859,1874,1890,1905,1920,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,120,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,181,211,226,
+	0,0,0,498,483,725,786,831,725,846,846,2827,2842,2857,2872,2887,
+	1935,1935,1935,1950,1935,1935,1935,2041,1935,1935,1935,1980,1935,1995,3114,3129,
+	2903,2903,2903,2918,2903,2903,2963,3008,2903,3144,3265,3311,3326,3326,3356,3371,
+	2903,2903,2903,3402,3386,3386,3386,3492,3386,3386,3386,3432,3507,7439,7469,7726,
+	7257,7499,7499,7544,7499,7499,7590,7726,7620,7620,7620,7665,7680,7696,7711,7726,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,105,
+	0,0,0,15,0,0,0,105,0,0,0,45,120,181,211,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,60,211,226,
+	0,0,0,15,0,0,60,347,241,241,362,408,423,922,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,408,362,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,665,695,710,
+	483,483,483,740,725,725,1753,1799,1693,1814,1814,1859,1874,1890,1905,1920,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,120,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,181,211,226,
+	0,0,0,15,0,725,786,831,725,846,846,892,907,922,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,211,226,
+	0,0,0,15,0,0,967,1073,967,1209,1330,3311,3265,3326,3356,3371,
+	2903,2903,2903,2918,2903,3386,3386,3492,3386,3386,3386,3432,3507,3568,3598,3613,
+	3386,3628,3628,3674,3628,3628,3719,3734,3749,3749,3749,3795,3810,3825,3840,3855,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,105,
+	0,0,0,15,0,0,0,105,0,0,0,45,120,181,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,60,211,226,
+	0,0,0,15,0,0,302,347,241,725,846,892,907,922,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,241,408,362,423,453,468,
+	0,0,0,15,0,0,967,1073,967,1451,1451,1496,1451,5503,5533,5549,
+	5322,5322,5564,5609,5564,5564,5654,5670,5564,5685,5685,5730,5745,5760,5775,5790,
+	3870,3870,3870,3885,3870,3870,3870,3916,3870,3870,3870,3916,3870,3870,3961,4097,
+	3870,3870,3870,3885,3870,3870,3870,3976,3870,3870,3870,5972,6168,6229,6259,6274,
+	5806,5806,5806,5821,5806,5806,5806,5911,5806,5806,5806,5851,5806,5987,6017,6032,
+	5806,6289,6289,6305,6531,6531,6592,6637,14273,14394,14394,14439,14454,14469,14484,14500,
+	13547,13547,13547,13562,13547,13547,14515,14621,14515,14515,14515,14560,14515,14575,14726,14742,
+	14515,14515,14515,14530,14515,14515,14575,14621,14757,14757,14878,14923,14938,14953,14968,15467,
+	14515,14999,14999,15014,14999,14999,14999,15104,14999,14999,14999,15044,15120,15180,15210,15467,
+	15240,15240,15240,15286,15240,15240,15331,15467,15361,15361,15361,15407,15422,15437,15452,15467,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,105,
+	0,0,0,15,0,0,0,105,0,0,0,45,120,181,211,226,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,60,211,226,
+	0,0,0,15,0,0,60,105,241,241,362,408,423,438,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,362,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,181,695,710,
+	483,483,483,498,725,725,786,831,725,846,1814,1859,1874,1890,1905,1920,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,120,181,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,181,211,226,
+	0,0,0,15,0,0,786,831,725,846,846,892,907,922,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,211,226,
+	0,0,0,15,0,0,0,105,0,0,1330,1375,1330,1391,1421,1436,
+	967,967,967,982,967,967,1451,1557,1451,1451,1451,3432,3507,3568,3598,3613,
+	3386,3386,3628,3674,3628,3628,3719,3734,3749,3749,3749,3795,3810,3825,3840,3855,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,105,
+	0,0,0,15,0,0,0,105,0,0,0,45,120,181,211,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,60,211,226,
+	0,0,0,15,0,0,60,347,241,241,846,892,907,922,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,408,362,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,1451,1496,1451,1632,1663,1678,
+	1451,1451,1451,1708,1693,1693,1753,1799,1693,1814,1814,1859,1874,1890,1905,1920,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,120,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,1980,1935,5987,6017,6032,
+	5806,5806,6289,6305,6289,6531,6592,6637,6531,6652,6652,6698,6713,6728,6743,6758,
+	5806,5806,5806,5821,5806,5806,5806,5911,5806,5806,6773,6819,6773,6834,6985,7000,
+	6773,6773,6773,6788,6773,6773,6834,6879,6773,7015,7136,7182,7197,7197,7227,7242,
+	6773,6773,7257,7272,7257,7257,7257,7363,7257,7257,7257,7302,7378,7439,7469,7726,
+	7257,7499,7499,7544,7499,7499,7590,7726,7620,7620,7620,7665,7680,7696,7711,7726,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,105,
+	0,0,0,15,0,0,0,105,0,0,0,45,120,181,211,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,60,211,226,
+	0,0,0,15,0,0,60,347,241,241,362,408,907,922,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,408,362,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,483,665,695,710,
+	483,483,1451,1708,1693,1693,1753,1799,1693,1814,1814,1859,1874,1890,1905,1920,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,120,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,181,211,226,
+	0,0,0,15,483,725,786,831,8467,8588,8588,8633,8648,8663,8678,8694,
+	7741,7741,7741,7756,7741,7741,7741,7786,7741,7741,7741,9722,9676,9676,9888,9903,
+	9676,9676,10644,10659,10644,10644,10644,10750,10644,10886,11007,11052,11007,11067,11098,11113,
+	10644,10644,10644,10659,11128,11128,11128,11234,11128,11128,11128,26656,26732,26792,26822,26838,
+	26611,26853,26853,26898,26853,26853,26943,26958,26974,26974,26974,27019,27034,27049,27064,27079,
+	7741,23224,23224,23224,23224,23224,23224,23269,23224,23224,23224,23269,23224,23224,23315,23451,
+	23224,23224,23224,23239,23224,23224,23224,23330,23224,23224,23224,23390,23345,23405,23677,23693,
+	23224,23224,23224,23239,23224,23224,23224,23330,23224,23224,23224,23269,23224,27276,27306,27321,
+	27095,27095,27095,27110,27095,27095,27397,27442,27820,27941,27941,27987,28002,28017,28032,28047,
+	27095,27095,27095,27110,27095,27095,27095,27140,27095,27095,27095,27140,27095,27095,27306,27321,
+	27095,27095,27095,27110,27095,27095,27095,27200,27095,27095,27457,27503,27457,27518,27548,27563,
+	27095,27095,28062,28077,28062,28062,28062,28168,28546,28546,28546,28591,28667,28728,28758,28773,
+	28546,28546,28788,28833,28788,28788,28879,28894,28909,28909,28909,28954,28969,28985,29000,29015,
+	27095,27095,27095,27110,27095,27095,27095,27140,27095,27095,27095,29075,29030,29030,29121,29257,
+	29030,29030,29030,29045,29030,29030,29030,29136,29030,29030,29030,29196,29393,29453,29484,29499,
+	29030,29030,29030,29045,29030,29030,29030,29136,29030,29030,29030,29075,29030,29211,29242,29741,
+	29514,29514,29514,29529,29756,29756,29816,29862,29756,29877,29877,29922,29937,30920,30935,30950,
+	29030,29030,29998,30013,29998,29998,29998,30103,29998,29998,29998,30043,29998,30058,30209,30224,
+	29998,29998,29998,30013,29998,29998,30058,30345,30240,30240,30360,30406,30421,30436,30935,30950,
+	30481,30481,30481,30497,30481,30481,30481,30587,30481,30481,30481,30527,30602,30663,30693,30950,
+	30723,30723,30723,30769,30723,30723,30814,30950,30844,30844,30844,30890,30905,30920,30935,30950,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,105,
+	0,0,0,15,0,0,0,105,0,0,0,45,120,181,211,226,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,60,211,226,
+	0,0,0,15,0,0,60,105,241,241,362,408,423,423,453,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,362,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,181,211,710,
+	483,483,483,498,725,725,786,831,725,846,846,892,1874,1890,1905,1920,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,120,181,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,181,211,226,
+	0,0,0,15,0,0,302,831,725,846,846,892,907,922,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,211,226,
+	0,0,0,15,0,0,0,105,0,0,362,408,1330,1391,1421,1436,
+	967,967,967,982,967,967,967,1557,1451,1451,1451,1496,1572,1632,1663,1678,
+	1451,1451,1693,3674,3628,3628,3719,3734,3749,3749,3749,3795,3810,3825,3840,3855,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,105,
+	0,0,0,15,0,0,0,105,0,0,0,45,120,181,211,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,60,211,226,
+	0,0,0,15,0,0,60,347,241,241,362,892,907,922,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,408,362,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,529,1451,1632,1663,1678,
+	1451,1451,1451,1708,1693,1693,1753,1799,1693,1814,1814,1859,1874,1890,1905,1920,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,120,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,181,211,226,
+	0,0,0,2434,2419,2661,2721,2766,2661,2782,2782,2827,2842,2857,2872,2887,
+	1935,1935,1935,1950,1935,1935,1935,2041,1935,1935,1935,1980,2903,6834,6985,7000,
+	6773,6773,6773,6788,6773,6773,6834,6879,6773,7015,7136,7182,7197,7197,7227,7242,
+	6773,6773,6773,7272,7257,7257,7257,7363,7257,7257,7257,7302,7378,7439,7469,7726,
+	7257,7499,7499,7544,7499,7499,7590,7726,7620,7620,7620,7665,7680,7696,7711,7726,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,105,
+	0,0,0,15,0,0,0,105,0,0,0,45,120,181,211,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,60,211,226,
+	0,0,0,15,0,0,60,347,241,241,362,408,423,922,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,408,362,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,665,695,710,
+	483,483,483,740,1693,1693,1753,1799,1693,1814,1814,1859,1874,1890,1905,1920,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,120,423,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,181,211,226,
+	0,0,0,15,0,725,786,831,725,846,846,892,907,922,937,952,
+	0,0,0,15,0,0,0,45,0,0,0,45,0,0,211,226,
+	0,0,0,1950,2903,2903,2903,3008,2903,3144,3265,3311,3265,3326,3356,3371,
+	2903,2903,2903,2918,2903,3386,3386,3492,3386,3386,3386,3432,3507,3568,3598,3613,
+	3386,3628,3628,3674,3628,3628,3719,3734,3749,3749,3749,3795,3810,3825,3840,3855,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,226,
+	0,0,0,15,0,0,0,105,0,0,0,166,120,181,453,468,
+	0,0,0,15,0,0,0,105,0,0,0,45,0,181,211,226,
+	0,0,0,15,0,0,302,347,7983,8588,8588,8633,8648,8663,8678,8694,
+	7741,7741,7741,7756,7741,7741,7741,7786,7741,7741,7741,7786,7741,11612,11823,11838,
+	11612,11612,11612,11627,11612,11612,11612,11718,11612,11612,11975,12020,11975,12035,12065,12080,
+	11612,11612,11612,11627,12579,12579,12579,12685,12579,13063,13063,13109,13184,13245,13275,13290,
+	13063,13063,13305,13350,13305,13305,13396,13411,13426,13426,13426,13471,13487,13502,13517,13532,
+	11612,11612,11612,11627,11612,11612,11612,11657,11612,11612,11612,11657,11612,11612,11702,11838,
+	11612,11612,11612,13562,13547,13547,13547,13653,13547,13547,13547,13713,13910,13970,14001,14016,
+	13547,13547,13547,13562,13547,13547,13547,13653,13547,13547,13547,13592,13547,13728,13759,13774,
+	13547,14031,14031,14046,14273,14273,14333,14379,14273,14394,14394,14439,45420,45435,45450,46433,
+	13547,13547,44513,44528,45480,45480,45480,45586,45480,45480,45480,45526,45480,45541,45692,45707,
+	45480,45480,45480,45496,45480,45480,45541,45828,45722,45722,45843,45889,45904,45919,46418,46433,
+	45480,45964,45964,45979,45964,45964,45964,46070,45964,45964,45964,46010,46085,46146,46176,46433,
+	46206,46206,46206,46252,46206,46206,46297,46433,46327,46327,46327,46373,46388,46403,46418,46433,
+	0,0,0,0,0,0,0,45,0,0,0,45,0,0,90,105,
+	0,0,0,15,0,30965,30965,31071,30965,30965,30965,31011,31086,31147,31177,31434,
+	30965,30965,30965,30980,30965,30965,30965,31071,30965,30965,30965,31011,30965,31026,31177,31192,
+	30965,30965,30965,30980,30965,30965,31026,31313,31207,31207,31328,31374,31389,31404,31903,31918,
+	30965,30965,30965,30980,30965,30965,30965,31011,30965,30965,30965,31011,30965,30965,31056,31192,
+	30965,30965,30965,30980,30965,30965,30965,31071,30965,30965,30965,31374,31328,31389,31419,31434,
+	30965,30965,30965,30980,30965,30965,30965,31071,30965,30965,30965,31011,30965,31147,31661,31676,
+	31449,31449,31449,31706,31691,31691,31752,31797,32659,32780,32780,32825,32840,32855,32870,32886,
+	30965,30965,30965,30965,30965,30965,30965,31011,30965,30965,30965,31011,30965,30965,31056,31192,
+	30965,30965,30965,30980,30965,30965,30965,31071,30965,30965,30965,31132,31086,31389,31419,31434,
+	30965,30965,30965,30980,30965,30965,30965,31071,30965,30965,30965,31011,30965,31147,31177,31192,
+	30965,30965,30965,30980,30965,31207,31752,31797,31691,31812,31812,31857,31872,31888,31903,31918,
+	30965,30965,30965,30980,30965,30965,30965,31011,30965,30965,30965,31011,30965,30965,31177,31192,
+	30965,30965,30965,30980,30965,30965,30965,31071,31933,32175,32296,32341,32296,32356,32387,32402,
+	31933,31933,31933,33883,33868,33868,34352,34458,34352,34352,34352,49880,49956,50016,50047,50062,
+	49835,50077,50077,50122,50077,50077,50168,50183,50198,50198,50198,50243,50258,50274,50289,50304,
+	30965,46448,46448,46448,46448,46448,46448,46494,46448,46448,46448,46494,46448,46448,46539,46554,
+	46448,46448,46448,46463,46448,46448,46448,46554,46448,46448,46448,46494,46569,46630,46902,46917,
+	46448,46448,46448,46463,46448,46448,46448,46554,46448,46448,46448,46494,46448,46509,46660,46675,
+	46448,46448,46448,46463,46448,46448,46751,46796,46690,46690,47295,47340,47355,47370,47386,47401,
+	46448,46448,46448,46463,46448,46448,46448,46494,46448,46448,46448,46494,46448,46448,46539,46675,
+	46448,46448,46448,46463,46448,46448,46448,46554,46448,46448,46690,46856,46811,46872,46902,46917,
+	46448,46448,46448,46463,46448,46448,46448,46554,47416,47416,47900,47945,47900,48081,48111,48126,
+	47900,47900,48142,48187,48142,48142,48232,48247,48142,48263,48263,48308,48323,48338,48353,48368,
+	46448,46448,46448,46463,46448,46448,46448,46494,46448,46448,46448,46494,46448,50319,50410,50546,
+	50319,50319,50319,50334,50319,50319,50319,50425,50319,50319,50319,50485,50682,50742,50772,50788,
+	50319,50319,50319,52269,52254,52254,52254,52360,52254,52254,52254,52300,52254,52436,52466,52481,
+	52254,52254,52738,52753,52980,52980,53040,53086,52980,53101,53101,53146,53161,53177,53192,53207,
+	52254,52254,52254,52269,52254,52254,52254,52360,53222,53222,53222,53267,53222,53282,53434,53449,
+	53222,53222,53222,53237,53222,53222,53282,53328,53464,53464,53585,53630,53645,53645,53676,54174,
+	53222,53222,53706,53721,53706,53706,53706,53812,53706,53706,53706,53751,53827,53887,53917,54174,
+	53948,53948,53948,53993,53948,53948,54038,54174,54069,54069,54069,54114,54129,54144,54159,54174,
+	46448,46448,46448,46448,46448,46448,46448,46494,46448,46448,46448,46494,46448,46448,46539,46554,
+	46448,46448,46448,46463,46448,46448,46448,46554,46448,46448,46448,46494,46569,46630,46660,46917,
+	46448,46448,46448,46463,46448,46448,46448,46554,46448,46448,46448,46494,46448,46509,46660,46675,
+	46448,46448,46448,46463,46448,46448,46509,46796,54432,54432,54552,54598,55097,55112,55127,55142,
+	54190,54190,54190,54205,54190,54190,54190,54235,54190,54190,54190,54235,54190,54190,54280,54416,
+	54190,54190,54190,54205,54190,54190,54190,54295,54190,54190,54190,54598,54552,54613,54643,54658,
+	54190,54190,54190,54205,54190,54190,54190,54295,54190,54190,54190,54235,54673,54855,54885,55868,
+	55641,55641,55641,55898,55883,55883,55944,55989,55883,56004,56004,56049,56064,56080,56095,56110,
+	54190,54190,54190,54205,54190,54190,54190,54235,54190,54190,54190,54235,54190,54190,54280,54416,
+	54190,54190,54190,54205,54190,54190,54190,54295,54190,54190,54190,54356,54311,54613,54643,54658,
+	54190,54190,54190,54205,54190,54190,54190,54295,54190,54190,54190,54235,54190,54371,54401,54416,
+	54190,54190,54190,54205,54673,54915,54976,55021,54915,55036,55036,55082,55097,57047,57062,57078,
+	54190,54190,54190,56140,56125,56125,56125,56170,56125,56125,56125,56170,56125,56125,56337,57319,
+	57093,57093,57093,57108,57093,57093,57093,57198,57093,57335,57456,57501,57456,57516,57546,57561,
+	57093,57093,57093,57108,57576,57576,57576,57682,57576,57576,57576,57622,57697,57758,57788,57803,
+	57576,57818,57818,57864,57818,57818,57909,61916,61810,61810,61810,61855,61871,61886,61901,61916,
+	54190,54190,54190,54190,54190,54190,54190,54235,54190,54190,54190,54235,54190,58060,58151,58287,
+	58060,58060,58060,58075,58060,58060,58060,58166,58060,58060,58060,58227,58181,58242,58514,58529,
+	58060,58060,58060,58075,58060,58060,58060,58166,58060,58060,58060,58106,58060,58242,58272,58287,
+	58060,58060,58060,58075,58060,58060,58363,58892,58786,58907,58907,58952,58968,58983,58998,59013,
+	58060,58060,58060,58075,58060,58060,58060,58106,58060,58060,58060,58106,58060,58060,58272,58287,
+	58060,58060,58060,58075,58060,58060,58060,58166,58060,58060,58423,58469,58423,58484,59482,59497,
+	59028,59028,59028,59043,59028,59028,59028,59618,59512,59512,59512,59557,59633,59693,59724,59739,
+	59512,59512,59754,59799,59754,59754,59844,59860,61810,61810,61810,61855,61871,61886,61901,61916,
+	58060,58060,58060,60011,59996,59996,59996,60041,59996,59996,59996,60041,59996,59996,60086,60222,
+	59996,59996,59996,60011,59996,59996,59996,60102,59996,59996,59996,60162,60359,60419,60449,60464,
+	59996,59996,59996,60011,59996,59996,59996,60102,59996,59996,59996,60041,59996,60177,60207,60706,
+	60480,60480,60480,60495,60721,60721,60782,60827,60721,60842,60842,61855,61871,61886,61901,61916,
+	60963,60963,60963,60978,60963,60963,60963,61069,60963,60963,60963,61009,60963,61024,61175,61190,
+	60963,60963,60963,60978,60963,60963,61024,61311,61205,61205,61326,61372,61387,61886,61901,61916,
+	61447,61447,61447,61462,61447,61447,61447,61553,61447,61447,61447,61493,61568,61629,61659,61916,
+	61689,61689,61689,61734,61689,61689,61780,61916,61810,61810,61810,61855,61871,61886,61901,61916
+};
+
+int PulseTriSaw_8580[4096] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,241,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,514,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	1935,2903,2903,2903,2903,2903,2903,2933,2903,2903,2903,2903,2903,2903,2903,3008,
+	3386,3386,3386,3386,3386,3386,3386,3417,3628,3628,3628,3628,3749,3749,3810,3855,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,967,1073,
+	1451,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,483,483,514,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,241,241,362,362,423,468,
+	5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5896,
+	5806,5806,5806,5806,5806,5806,5806,5836,5806,5806,5806,5806,5806,5927,5987,6032,
+	6773,6773,6773,6773,6773,6773,6773,6804,6773,6773,6773,6773,6773,6773,6773,6879,
+	7257,7257,7257,7257,7257,7257,7257,7287,7499,7499,7499,7499,7620,7620,7680,7726,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	1451,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,483,514,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,241,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,1935,1935,1935,2056,2116,2162,
+	2903,2903,2903,2903,2903,2903,2903,2933,2903,2903,2903,2903,2903,2903,2903,3008,
+	3386,3386,3386,3386,3386,3386,3386,3417,3628,3628,3628,3628,3749,3749,3810,3855,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,967,967,967,967,967,1073,
+	1451,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,483,483,483,514,725,725,725,725,846,846,907,952,
+	11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11702,
+	11612,11612,11612,11612,11612,11612,11612,11642,11612,11612,11612,11612,11612,11612,11793,11838,
+	11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11612,11718,
+	11612,11612,11612,11612,11612,11612,11612,11642,11612,11612,11854,11854,11975,11975,12035,12080,
+	13547,13547,13547,13547,13547,13547,13547,13547,13547,13547,13547,13547,13547,13547,13547,13638,
+	13547,13547,13547,13547,13547,13547,13547,13577,13547,13547,13547,13547,13547,13668,13728,13774,
+	14515,14515,14515,14515,14515,14515,14515,14545,14515,14515,14515,14515,14515,14515,14515,14621,
+	14999,14999,14999,14999,14999,14999,14999,15029,15240,15240,15240,15240,15361,15361,15422,15467,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	1451,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,514,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	2903,2903,2903,2903,2903,2903,2903,2933,2903,2903,2903,2903,2903,2903,2903,3008,
+	3386,3386,3386,3386,3386,3386,3386,3417,3628,3628,3628,3628,3749,3749,3810,3855,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,967,967,967,1073,
+	1451,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,483,483,514,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	3870,3870,3870,3870,3870,3870,3870,3900,3870,3870,4112,4112,4233,4233,4294,4339,
+	5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5806,5896,
+	5806,5806,5806,5806,5806,5806,5806,5836,5806,5806,5806,5806,5806,5927,5987,6032,
+	6773,6773,6773,6773,6773,6773,6773,6804,6773,6773,6773,6773,6773,6773,6773,6879,
+	7257,7257,7257,7257,7257,7257,7257,7287,7499,7499,7499,7499,7620,7620,7680,7726,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,120,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	1451,1451,1451,1451,1451,1451,1451,1481,1693,1693,1693,1693,1814,1814,1874,1920,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,483,514,725,725,725,725,846,846,907,952,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,241,241,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,1935,1935,1935,1935,1935,1965,1935,1935,1935,1935,1935,2056,2116,2162,
+	2903,2903,2903,2903,2903,2903,2903,2933,2903,2903,2903,2903,2903,2903,2903,3008,
+	3386,3386,3386,3386,3386,3386,3386,3417,3628,3628,3628,3628,3749,3749,3810,3855,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,
+	0,0,0,0,0,0,0,30,0,0,0,0,362,362,423,468,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,
+	0,0,0,0,0,0,0,30,0,0,0,0,0,0,181,226,
+	15482,15482,15482,15482,15482,15482,15482,15513,15482,15482,15482,15482,15482,15482,15482,15588,
+	15482,15482,15482,15482,15482,15482,15482,15513,16208,16208,16208,16208,16329,16329,16390,16435,
+	15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15573,
+	15482,15482,15482,15482,15482,15482,15482,15513,15482,15482,15482,15482,15482,15482,15664,15709,
+	15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15588,
+	15482,15482,15482,15482,15482,15482,15482,15513,15482,15482,15482,15724,15845,15845,15906,15951,
+	15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15482,15573,
+	15482,15482,15482,15482,15482,15482,15482,15513,15482,15482,15482,15482,15482,15603,15664,15709,
+	15482,15482,15482,15482,15482,15482,15482,15513,16450,16450,16450,16450,16450,16450,16450,16556,
+	16934,16934,16934,16934,16934,16934,16934,16964,17176,17176,17176,17176,17297,17297,17357,17403,
+	23224,23224,23224,23224,23224,23224,23224,23224,23224,23224,23224,23224,23224,23224,23224,23315,
+	23224,23224,23224,23224,23224,23224,23224,23254,23224,23224,23224,23224,23224,23224,23405,23451,
+	23224,23224,23224,23224,23224,23224,23224,23224,23224,23224,23224,23224,23224,23224,23224,23330,
+	23224,23224,23224,23224,23224,23224,23224,23254,23224,23224,23224,23224,23587,23587,23647,23693,
+	54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54190,54280,
+	54190,54190,54190,54190,54190,54190,54190,54220,54190,54190,54190,54190,54190,54190,54371,54416,
+	54190,54190,54190,54190,54190,54190,54190,54220,54190,54190,54190,54190,54190,54190,54190,54295,
+	54190,54190,54190,54190,54673,54673,54673,54704,54915,54915,54915,54915,55036,55036,55097,55142,
+	58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58151,
+	58060,58060,58060,58060,58060,58060,58060,58091,58060,58060,58060,58060,58060,58060,58242,58287,
+	58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58060,58166,
+	58060,58060,58060,58060,58060,58060,58060,58091,58060,58060,58302,58302,58423,58423,58484,58529,
+	59996,59996,59996,59996,59996,59996,59996,59996,59996,59996,59996,59996,59996,59996,59996,60086,
+	59996,59996,59996,59996,59996,59996,59996,60026,59996,59996,59996,59996,59996,60117,60177,60222,
+	60963,60963,60963,60963,60963,60963,60963,60994,60963,60963,60963,60963,60963,60963,60963,61069,
+	61447,61447,61447,61447,61447,61447,61447,61477,61689,61689,61689,61689,61810,61810,61871,61916
+};
+
+int PulseTri_8580[8192] = {
+	0,0,0,0,0,0,0,62,0,0,0,0,0,0,124,218,
+	0,0,0,0,0,0,0,218,0,0,0,62,249,374,436,468,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,374,468,
+	0,0,0,0,0,0,0,218,0,499,748,811,748,873,936,1965,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,468,
+	0,0,0,0,0,0,0,218,0,0,0,312,748,873,936,967,
+	0,0,0,0,0,0,0,218,0,0,0,0,0,374,374,1466,
+	0,998,998,998,1497,1497,1622,1716,1497,1747,1747,1840,1872,1872,3931,3962,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,218,
+	0,0,0,0,0,0,0,218,0,0,0,62,249,374,936,967,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,374,468,
+	0,0,0,0,0,0,499,1716,1497,1497,1747,1809,1747,1872,1934,1965,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,468,
+	0,0,0,0,0,0,0,218,0,0,499,811,748,873,2932,2964,
+	1996,1996,1996,1996,1996,1996,1996,3213,2995,2995,2995,3057,2995,3369,3432,3463,
+	2995,2995,3494,3494,3494,3494,3619,7706,7488,7737,7737,7831,7862,7862,7924,7956,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,218,
+	0,0,0,0,0,0,0,218,0,0,0,62,249,374,436,967,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,374,468,
+	0,0,0,0,0,0,0,717,499,499,748,1809,1747,1872,1934,1965,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,468,
+	0,0,0,0,0,0,0,218,0,0,0,811,748,873,936,967,
+	0,0,0,0,0,0,0,218,0,0,0,998,998,1372,3369,3463,
+	2995,2995,2995,3494,3494,3494,3619,3712,3494,3744,3744,3837,3868,3868,3931,3962,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,468,
+	0,0,0,0,0,0,0,218,0,0,0,312,249,873,936,967,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,249,374,468,
+	0,0,0,998,998,1497,1497,5709,5491,5740,5740,5834,5740,5865,5928,5959,
+	3993,3993,3993,3993,3993,3993,3993,4087,3993,3993,3993,3993,3993,3993,6364,6458,
+	5990,5990,5990,5990,5990,5990,5990,6208,5990,6489,6739,6801,14726,14851,14913,14944,
+	13977,13977,13977,14976,14976,14976,14976,15194,14976,14976,14976,15038,15225,15350,15412,15444,
+	14976,15475,15475,15475,15475,15475,15600,15693,15724,15724,15724,15818,15849,15849,15912,15943,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,218,
+	0,0,0,0,0,0,0,218,0,0,0,62,249,374,436,967,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,374,468,
+	0,0,0,0,0,0,0,717,499,499,748,811,748,1872,1934,1965,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,468,
+	0,0,0,0,0,0,0,218,0,0,0,811,748,873,936,967,
+	0,0,0,0,0,0,0,218,0,0,0,0,0,1372,1372,1466,
+	998,998,998,1497,1497,1497,3619,3712,3494,3744,3744,3837,3868,3868,3931,3962,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,218,
+	0,0,0,0,0,0,0,218,0,0,0,62,249,873,936,967,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,374,468,
+	0,0,0,0,0,1497,1497,1716,1497,1497,1747,1809,1747,1872,1934,1965,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,468,
+	0,0,0,0,0,0,1996,6208,5990,6489,6489,6801,6739,6864,6926,6957,
+	5990,5990,5990,5990,5990,6988,6988,7207,6988,6988,6988,7051,6988,7363,7425,7456,
+	6988,7488,7488,7488,7488,7488,7612,7706,7488,7737,7737,7831,7862,7862,7924,7956,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,218,
+	0,0,0,0,0,0,0,218,0,0,0,62,249,374,936,967,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,374,468,
+	0,0,0,0,0,0,499,717,499,1497,1747,1809,1747,1872,1934,1965,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,468,
+	0,0,0,0,0,0,0,218,0,0,499,811,8736,8860,8923,8954,
+	7987,7987,7987,7987,7987,7987,9984,10202,9984,10982,10982,10982,10982,11356,11356,11450,
+	10982,10982,11481,11481,11481,11481,27580,27674,27456,27705,27705,27799,27830,27830,27892,27924,
+	7987,23961,23961,23961,23961,23961,23961,24055,23961,23961,23961,23961,23961,23961,24086,24429,
+	23961,23961,23961,23961,23961,23961,23961,28173,27955,27955,27955,28267,28704,28828,28891,28922,
+	27955,27955,27955,27955,27955,27955,27955,28173,27955,27955,27955,27955,27955,28329,28329,28423,
+	27955,28953,28953,28953,29452,29452,29577,29671,29452,29702,29702,29796,29827,29827,29889,29920,
+	27955,27955,27955,27955,27955,27955,29952,30045,29952,29952,29952,29952,29952,29952,30326,30420,
+	29952,29952,29952,29952,29952,29952,29952,30170,30451,30451,30700,30763,30700,30825,30888,31917,
+	29952,30950,30950,30950,30950,30950,30950,31168,30950,30950,30950,31012,31200,31324,31387,31917,
+	31449,31449,31449,31449,31449,31449,31574,31668,31699,31699,31699,31792,31824,31824,31886,31917,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,218,
+	0,0,0,0,0,0,0,218,0,0,0,62,249,374,436,468,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,374,468,
+	0,0,0,0,0,0,0,218,499,499,748,811,748,873,1934,1965,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,468,
+	0,0,0,0,0,0,0,218,0,0,0,312,748,873,936,967,
+	0,0,0,0,0,0,0,218,0,0,0,0,0,374,1372,1466,
+	998,998,998,998,1497,1497,1622,1716,1497,1747,3744,3837,3868,3868,3931,3962,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,218,
+	0,0,0,0,0,0,0,218,0,0,0,62,249,374,936,967,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,374,468,
+	0,0,0,0,0,0,1497,1716,1497,1497,1747,1809,1747,1872,1934,1965,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,468,
+	0,0,0,0,0,0,0,218,0,0,2496,2808,2745,2870,2932,2964,
+	1996,1996,1996,1996,1996,1996,2995,7207,6988,6988,6988,7051,6988,7363,7425,7456,
+	6988,6988,7488,7488,7488,7488,7612,7706,7488,7737,7737,7831,7862,7862,7924,7956,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,218,
+	0,0,0,0,0,0,0,218,0,0,0,62,249,374,436,967,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,374,468,
+	0,0,0,0,0,0,0,717,499,499,1747,1809,1747,1872,1934,1965,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,468,
+	0,0,0,0,0,0,0,218,0,0,0,811,748,873,936,967,
+	0,0,0,0,0,0,0,218,0,0,2995,2995,2995,3369,3369,3463,
+	2995,2995,2995,3494,3494,3494,3619,3712,3494,3744,3744,3837,3868,3868,3931,3962,
+	0,0,0,0,0,0,0,93,0,0,0,0,0,0,124,468,
+	0,0,0,0,0,0,0,218,0,0,0,312,8236,8860,8923,8954,
+	7987,7987,7987,7987,7987,7987,7987,12199,11980,11980,11980,11980,11980,12355,12355,12448,
+	11980,11980,12979,12979,12979,13478,13603,13696,13478,13728,13728,13821,13852,13852,13915,13946,
+	11980,11980,11980,11980,11980,11980,11980,12074,11980,11980,13977,13977,13977,13977,14352,14445,
+	13977,13977,13977,13977,13977,13977,13977,14196,13977,14476,14726,14788,14726,14851,46862,46893,
+	13977,45926,46924,46924,46924,46924,46924,47143,46924,46924,46924,46987,47174,47299,47361,47892,
+	46924,47424,47424,47424,47424,47424,47548,47642,47673,47673,47673,47767,47798,47798,47860,47892,
+	0,0,0,0,0,0,0,93,0,0,0,31948,31948,31948,32073,32167,
+	31948,31948,31948,31948,31948,31948,31948,32167,31948,31948,31948,32011,32198,32323,32385,32916,
+	31948,31948,31948,31948,31948,31948,31948,32042,31948,31948,31948,31948,31948,31948,32323,32416,
+	31948,31948,31948,31948,31948,31948,31948,32666,32448,32448,32697,32760,33696,33820,33883,33914,
+	31948,31948,31948,31948,31948,31948,31948,32042,31948,31948,31948,31948,31948,31948,32073,32416,
+	31948,31948,31948,31948,31948,31948,31948,32167,31948,31948,31948,32760,32697,32822,32884,32916,
+	31948,31948,31948,31948,31948,31948,31948,32167,31948,31948,31948,31948,32947,33321,33321,33415,
+	32947,32947,34944,35443,35443,35443,51542,51636,51417,51667,51667,51760,51792,51792,51854,51885,
+	31948,47923,47923,47923,47923,47923,47923,48016,47923,47923,47923,47923,47923,47923,48048,48391,
+	47923,47923,47923,47923,47923,47923,47923,48141,47923,47923,47923,48235,48172,48796,48859,48890,
+	47923,47923,47923,47923,47923,47923,47923,48016,47923,47923,47923,47923,47923,48172,48297,48391,
+	47923,47923,47923,47923,48921,49420,49420,49639,49420,49670,49670,49764,49670,49795,49857,49888,
+	47923,47923,47923,47923,47923,47923,47923,52010,51916,51916,51916,51916,51916,51916,52291,52384,
+	51916,51916,53913,53913,53913,53913,53913,54132,53913,54412,54662,54724,54662,54787,54849,54880,
+	53913,53913,53913,53913,54912,54912,54912,55130,54912,54912,54912,54974,55161,55286,55348,55380,
+	54912,55411,55411,55411,55411,55411,55536,55629,55660,55660,55660,55754,55785,55785,55848,55879,
+	47923,47923,47923,47923,47923,47923,47923,48016,47923,47923,47923,47923,47923,47923,48048,48141,
+	47923,47923,47923,47923,47923,47923,47923,48141,47923,47923,47923,47985,56160,56284,56846,56877,
+	55910,55910,55910,55910,55910,55910,55910,56004,55910,55910,55910,55910,55910,55910,56284,56378,
+	55910,55910,55910,55910,55910,55910,56409,56628,57408,57408,57657,57720,57657,57782,57844,57876,
+	55910,55910,55910,55910,55910,55910,55910,56004,55910,55910,55910,55910,55910,55910,56035,56378,
+	55910,55910,55910,55910,55910,55910,55910,56128,55910,55910,56409,56721,56659,56784,56846,58874,
+	55910,55910,57907,57907,57907,57907,57907,58125,58905,58905,58905,58905,58905,59280,59280,59373,
+	58905,58905,59404,59404,59404,59404,59529,59623,59404,59654,59654,59748,63772,63772,63835,63866,
+	55910,55910,55910,55910,55910,55910,55910,59997,59904,59904,59904,59904,59904,59904,60028,60372,
+	59904,59904,59904,59904,59904,59904,59904,60122,59904,59904,59904,60216,60652,60777,60840,60871,
+	59904,59904,59904,59904,59904,59904,59904,60122,59904,59904,59904,59904,59904,60278,60278,61370,
+	60902,60902,60902,60902,61401,61401,61526,61620,61401,61651,61651,61744,63772,63772,63835,63866,
+	59904,59904,61900,61900,61900,61900,61900,61994,61900,61900,61900,61900,61900,61900,62275,62368,
+	61900,61900,61900,61900,61900,61900,61900,62119,62400,62400,62649,62712,62649,62774,63835,63866,
+	62899,62899,62899,62899,62899,62899,62899,63117,62899,62899,62899,62961,63148,63273,63336,63866,
+	63398,63398,63398,63398,63398,63398,63523,63616,63648,63648,63648,63741,63772,63772,63772,0,
+	63772,0,63772,63772,63772,63741,63648,63648,63648,63616,63523,63398,63398,63398,63398,63398,
+	63398,63866,63336,63273,63148,62961,62899,62899,62899,63117,62899,62899,62899,62899,62899,62899,
+	62899,63866,63835,62774,62649,62712,62649,62400,62400,62119,61900,61900,61900,61900,61900,61900,
+	61900,62368,62275,61900,61900,61900,61900,61900,61900,61994,61900,61900,61900,61900,61900,59904,
+	59904,63866,63835,63772,63772,61744,61651,61651,61401,61620,61526,61401,61401,60902,60902,60902,
+	60902,61370,60278,60278,59904,59904,59904,59904,59904,60122,59904,59904,59904,59904,59904,59904,
+	59904,60871,60840,60777,60652,60216,59904,59904,59904,60122,59904,59904,59904,59904,59904,59904,
+	59904,60372,60028,59904,59904,59904,59904,59904,59904,59997,55910,55910,55910,55910,55910,55910,
+	55910,63866,63835,63772,63772,59748,59654,59654,59404,59623,59529,59404,59404,59404,59404,58905,
+	58905,59373,59280,59280,58905,58905,58905,58905,58905,58125,57907,57907,57907,57907,57907,55910,
+	55910,58874,56846,56784,56659,56721,56409,55910,55910,56128,55910,55910,55910,55910,55910,55910,
+	55910,56378,56035,55910,55910,55910,55910,55910,55910,56004,55910,55910,55910,55910,55910,55910,
+	55910,57876,57844,57782,57657,57720,57657,57408,57408,56628,56409,55910,55910,55910,55910,55910,
+	55910,56378,56284,55910,55910,55910,55910,55910,55910,56004,55910,55910,55910,55910,55910,55910,
+	55910,56877,56846,56284,56160,47985,47923,47923,47923,48141,47923,47923,47923,47923,47923,47923,
+	47923,48141,48048,47923,47923,47923,47923,47923,47923,48016,47923,47923,47923,47923,47923,47923,
+	47923,55879,55848,55785,55785,55754,55660,55660,55660,55629,55536,55411,55411,55411,55411,55411,
+	54912,55380,55348,55286,55161,54974,54912,54912,54912,55130,54912,54912,54912,53913,53913,53913,
+	53913,54880,54849,54787,54662,54724,54662,54412,53913,54132,53913,53913,53913,53913,53913,51916,
+	51916,52384,52291,51916,51916,51916,51916,51916,51916,52010,47923,47923,47923,47923,47923,47923,
+	47923,49888,49857,49795,49670,49764,49670,49670,49420,49639,49420,49420,48921,47923,47923,47923,
+	47923,48391,48297,48172,47923,47923,47923,47923,47923,48016,47923,47923,47923,47923,47923,47923,
+	47923,48890,48859,48796,48172,48235,47923,47923,47923,48141,47923,47923,47923,47923,47923,47923,
+	47923,48391,48048,47923,47923,47923,47923,47923,47923,48016,47923,47923,47923,47923,47923,47923,
+	31948,51885,51854,51792,51792,51760,51667,51667,51417,51636,51542,35443,35443,35443,34944,32947,
+	32947,33415,33321,33321,32947,31948,31948,31948,31948,32167,31948,31948,31948,31948,31948,31948,
+	31948,32916,32884,32822,32697,32760,31948,31948,31948,32167,31948,31948,31948,31948,31948,31948,
+	31948,32416,32073,31948,31948,31948,31948,31948,31948,32042,31948,31948,31948,31948,31948,31948,
+	31948,33914,33883,33820,33696,32760,32697,32448,32448,32666,31948,31948,31948,31948,31948,31948,
+	31948,32416,32323,31948,31948,31948,31948,31948,31948,32042,31948,31948,31948,31948,31948,31948,
+	31948,32916,32385,32323,32198,32011,31948,31948,31948,32167,31948,31948,31948,31948,31948,31948,
+	31948,32167,32073,31948,31948,31948,0,0,0,93,0,0,0,0,0,0,
+	0,47892,47860,47798,47798,47767,47673,47673,47673,47642,47548,47424,47424,47424,47424,47424,
+	46924,47892,47361,47299,47174,46987,46924,46924,46924,47143,46924,46924,46924,46924,46924,45926,
+	13977,46893,46862,14851,14726,14788,14726,14476,13977,14196,13977,13977,13977,13977,13977,13977,
+	13977,14445,14352,13977,13977,13977,13977,11980,11980,12074,11980,11980,11980,11980,11980,11980,
+	11980,13946,13915,13852,13852,13821,13728,13728,13478,13696,13603,13478,12979,12979,12979,11980,
+	11980,12448,12355,12355,11980,11980,11980,11980,11980,12199,7987,7987,7987,7987,7987,7987,
+	7987,8954,8923,8860,8236,312,0,0,0,218,0,0,0,0,0,0,
+	0,468,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,3962,3931,3868,3868,3837,3744,3744,3494,3712,3619,3494,3494,3494,2995,2995,
+	2995,3463,3369,3369,2995,2995,2995,0,0,218,0,0,0,0,0,0,
+	0,967,936,873,748,811,0,0,0,218,0,0,0,0,0,0,
+	0,468,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,1965,1934,1872,1747,1809,1747,499,499,717,0,0,0,0,0,0,
+	0,468,374,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,967,436,374,249,62,0,0,0,218,0,0,0,0,0,0,
+	0,218,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,7956,7924,7862,7862,7831,7737,7737,7488,7706,7612,7488,7488,7488,7488,6988,
+	6988,7456,7425,7363,6988,7051,6988,6988,6988,7207,2995,1996,1996,1996,1996,1996,
+	1996,2964,2932,2870,2745,2808,2496,0,0,218,0,0,0,0,0,0,
+	0,468,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,1965,1934,1872,1747,1809,1747,1497,1497,1716,1497,0,0,0,0,0,
+	0,468,374,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,967,936,374,249,62,0,0,0,218,0,0,0,0,0,0,
+	0,218,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,3962,3931,3868,3868,3837,3744,1747,1497,1716,1622,1497,1497,998,998,998,
+	998,1466,1372,374,0,0,0,0,0,218,0,0,0,0,0,0,
+	0,967,936,873,748,312,0,0,0,218,0,0,0,0,0,0,
+	0,468,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,1965,1934,873,748,811,748,499,499,218,0,0,0,0,0,0,
+	0,468,374,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,468,436,374,249,62,0,0,0,218,0,0,0,0,0,0,
+	0,218,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,31917,31886,31824,31824,31792,31699,31699,31699,31668,31574,31449,31449,31449,31449,31449,
+	31449,31917,31387,31324,31200,31012,30950,30950,30950,31168,30950,30950,30950,30950,30950,30950,
+	29952,31917,30888,30825,30700,30763,30700,30451,30451,30170,29952,29952,29952,29952,29952,29952,
+	29952,30420,30326,29952,29952,29952,29952,29952,29952,30045,29952,27955,27955,27955,27955,27955,
+	27955,29920,29889,29827,29827,29796,29702,29702,29452,29671,29577,29452,29452,28953,28953,28953,
+	27955,28423,28329,28329,27955,27955,27955,27955,27955,28173,27955,27955,27955,27955,27955,27955,
+	27955,28922,28891,28828,28704,28267,27955,27955,27955,28173,23961,23961,23961,23961,23961,23961,
+	23961,24429,24086,23961,23961,23961,23961,23961,23961,24055,23961,23961,23961,23961,23961,23961,
+	7987,27924,27892,27830,27830,27799,27705,27705,27456,27674,27580,11481,11481,11481,11481,10982,
+	10982,11450,11356,11356,10982,10982,10982,10982,9984,10202,9984,7987,7987,7987,7987,7987,
+	7987,8954,8923,8860,8736,811,499,0,0,218,0,0,0,0,0,0,
+	0,468,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,1965,1934,1872,1747,1809,1747,1497,499,717,499,0,0,0,0,0,
+	0,468,374,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,967,936,374,249,62,0,0,0,218,0,0,0,0,0,0,
+	0,218,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,7956,7924,7862,7862,7831,7737,7737,7488,7706,7612,7488,7488,7488,7488,7488,
+	6988,7456,7425,7363,6988,7051,6988,6988,6988,7207,6988,6988,5990,5990,5990,5990,
+	5990,6957,6926,6864,6739,6801,6489,6489,5990,6208,1996,0,0,0,0,0,
+	0,468,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,1965,1934,1872,1747,1809,1747,1497,1497,1716,1497,1497,0,0,0,0,
+	0,468,374,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,967,936,873,249,62,0,0,0,218,0,0,0,0,0,0,
+	0,218,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,3962,3931,3868,3868,3837,3744,3744,3494,3712,3619,1497,1497,1497,998,998,
+	998,1466,1372,1372,0,0,0,0,0,218,0,0,0,0,0,0,
+	0,967,936,873,748,811,0,0,0,218,0,0,0,0,0,0,
+	0,468,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,1965,1934,1872,748,811,748,499,499,717,0,0,0,0,0,0,
+	0,468,374,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,967,436,374,249,62,0,0,0,218,0,0,0,0,0,0,
+	0,218,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,15943,15912,15849,15849,15818,15724,15724,15724,15693,15600,15475,15475,15475,15475,15475,
+	14976,15444,15412,15350,15225,15038,14976,14976,14976,15194,14976,14976,14976,14976,13977,13977,
+	13977,14944,14913,14851,14726,6801,6739,6489,5990,6208,5990,5990,5990,5990,5990,5990,
+	5990,6458,6364,3993,3993,3993,3993,3993,3993,4087,3993,3993,3993,3993,3993,3993,
+	3993,5959,5928,5865,5740,5834,5740,5740,5491,5709,1497,1497,998,998,0,0,
+	0,468,374,249,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,967,936,873,249,312,0,0,0,218,0,0,0,0,0,0,
+	0,468,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,3962,3931,3868,3868,3837,3744,3744,3494,3712,3619,3494,3494,3494,2995,2995,
+	2995,3463,3369,1372,998,998,0,0,0,218,0,0,0,0,0,0,
+	0,967,936,873,748,811,0,0,0,218,0,0,0,0,0,0,
+	0,468,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,1965,1934,1872,1747,1809,748,499,499,717,0,0,0,0,0,0,
+	0,468,374,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,967,436,374,249,62,0,0,0,218,0,0,0,0,0,0,
+	0,218,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,7956,7924,7862,7862,7831,7737,7737,7488,7706,3619,3494,3494,3494,3494,2995,
+	2995,3463,3432,3369,2995,3057,2995,2995,2995,3213,1996,1996,1996,1996,1996,1996,
+	1996,2964,2932,873,748,811,499,0,0,218,0,0,0,0,0,0,
+	0,468,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,1965,1934,1872,1747,1809,1747,1497,1497,1716,499,0,0,0,0,0,
+	0,468,374,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,967,936,374,249,62,0,0,0,218,0,0,0,0,0,0,
+	0,218,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,3962,3931,1872,1872,1840,1747,1747,1497,1716,1622,1497,1497,998,998,998,
+	0,1466,374,374,0,0,0,0,0,218,0,0,0,0,0,0,
+	0,967,936,873,748,312,0,0,0,218,0,0,0,0,0,0,
+	0,468,124,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,1965,936,873,748,811,748,499,0,218,0,0,0,0,0,0,
+	0,468,374,0,0,0,0,0,0,93,0,0,0,0,0,0,
+	0,468,436,374,249,62,0,0,0,218,0,0,0,0,0,0,
+	0,218,124,0,0,0,0,0,0,62,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
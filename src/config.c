@@ -45,6 +45,8 @@ static const struct { int type; const char *name; void *param; int mask; } confi
 	{ C_INT, "window_height", &mused.window_h },
 	{ C_INT, "mix_rate", &mused.mix_rate },
 	{ C_INT, "mix_buffer", &mused.mix_buffer },
+	{ C_BOOL, "auto_mix_buffer", &mused.auto_mix_buffer, 1 },
+	{ C_STR, "tuned_mix_buffers", mused.tuned_mix_buffers, sizeof(mused.tuned_mix_buffers) - 1 },
 	{ C_BOOL, "compact", &mused.flags, COMPACT_VIEW },
 	{ C_BOOL, "track_focus", &mused.flags, EXPAND_ONLY_CURRENT_TRACK },
 	{ C_STR, "theme", mused.themename, sizeof(mused.themename) - 1 },
@@ -66,6 +68,7 @@ static const struct { int type; const char *name; void *param; int mask; } confi
 #ifdef MIDI
 	{ C_INT, "midi_device", &mused.midi_device },
 	{ C_INT, "midi_channel", &mused.midi_channel },
+	{ C_BOOL, "midi_clock_out", &mused.midi_clock_out, 1 },
 #endif
 	{ C_BOOL, "lock_pattern_length", &mused.flags, LOCK_SEQUENCE_STEP_AND_PATTERN_LENGTH },
 	{ C_BOOL, "edit_sequence_digits", &mused.flags, EDIT_SEQUENCE_DIGITS },
@@ -79,6 +82,7 @@ static const struct { int type; const char *name; void *param; int mask; } confi
 	{ C_BOOL, "use_system_cursor", &mused.flags, USE_SYSTEM_CURSOR },
 	{ C_BOOL, "show_logo", &mused.flags, SHOW_LOGO }, //wasn't there
 	{ C_BOOL, "show_analyzer", &mused.flags, SHOW_ANALYZER }, //wasn't there
+	{ C_BOOL, "show_dsp_load", &mused.flags, SHOW_DSP_LOAD },
 	{ C_END }
 };
 
@@ -100,8 +100,11 @@ void delete()
 		case EDITPATTERN:
 		snapshot(S_T_PATTERN);
 		if (mused.selection.start == mused.selection.end)
-			clear_pattern(&mused.song.pattern[current_pattern()]);
-		else
+		{
+			if (current_pattern() != -1)
+				clear_pattern_range(&mused.song.pattern[current_pattern()], 0, mused.song.pattern[current_pattern()].num_steps);
+		}
+		else if (get_pattern(mused.selection.start, mused.current_sequencetrack) != -1)
 			clear_pattern_range(&mused.song.pattern[get_pattern(mused.selection.start, mused.current_sequencetrack)], get_patternstep(mused.selection.start, mused.current_sequencetrack), get_patternstep(mused.selection.end, mused.current_sequencetrack));
 		
 		break;
@@ -145,23 +148,45 @@ void paste()
 		
 		case EDITPATTERN:
 		{
-			size_t items = cp_get_item_count(&mused.cp, sizeof(mused.song.pattern[current_pattern()].step[0]));
+			size_t items = cp_get_item_count(&mused.cp, sizeof(mused.song.pattern[0].step[0]));
 			
-			if (items < 1) 
+			if (items < 1 || current_pattern() == -1) 
 				break;
 			
+			// Pasted into a copy that is swapped in, see copy_pattern_steps()
+			
+			MusPattern *pattern = &mused.song.pattern[current_pattern()];
+			
 			if (mused.cp.type == CP_PATTERN)
 			{
+				MusStep *steps = copy_pattern_steps(pattern, items);
+				
+				if (!steps)
+				{
+					set_info_message("Out of memory!");
+					break;
+				}
+				
 				snapshot(S_T_PATTERN);
-				resize_pattern(&mused.song.pattern[current_pattern()], items);
-				cp_paste_items(&mused.cp, CP_PATTERN, mused.song.pattern[current_pattern()].step, items, sizeof(mused.song.pattern[current_pattern()].step[0]));
+				cp_paste_items(&mused.cp, CP_PATTERN, steps, items, sizeof(steps[0]));
+				swap_pattern_steps(pattern, steps, items);
 			}
-			else if (mused.cp.type == CP_PATTERNSEGMENT && (current_pattern() != -1))
+			else if (mused.cp.type == CP_PATTERNSEGMENT)
 			{
 				debug("paste to pattern %d", current_pattern());
+				
+				MusStep *steps = copy_pattern_steps(pattern, pattern->num_steps);
+				
+				if (!steps)
+				{
+					set_info_message("Out of memory!");
+					break;
+				}
+				
 				snapshot(S_T_PATTERN);
-				cp_paste_items(&mused.cp, CP_PATTERNSEGMENT, &mused.song.pattern[current_pattern()].step[current_patternstep()], mused.song.pattern[current_pattern()].num_steps-current_patternstep(), 
-					sizeof(mused.song.pattern[current_pattern()].step[0]));
+				cp_paste_items(&mused.cp, CP_PATTERNSEGMENT, &steps[current_patternstep()], pattern->num_steps-current_patternstep(), 
+					sizeof(steps[0]));
+				swap_pattern_steps(pattern, steps, pattern->num_steps);
 			}
 		}
 		break;
@@ -171,8 +196,13 @@ void paste()
 			if (mused.cp.type == CP_INSTRUMENT)
 			{
 				snapshot(S_T_INSTRUMENT);
-			
-				cp_paste_items(&mused.cp, CP_INSTRUMENT, &mused.song.instrument[mused.current_instrument], 1, sizeof(mused.song.instrument[mused.current_instrument]));
+				
+				MusInstrument inst = mused.song.instrument[mused.current_instrument];
+				cp_paste_items(&mused.cp, CP_INSTRUMENT, &inst, 1, sizeof(inst));
+				
+				cyd_lock(&mused.cyd, 1);
+				mused.song.instrument[mused.current_instrument] = inst;
+				cyd_lock(&mused.cyd, 0);
 			}
 		}
 		break;
@@ -187,8 +217,14 @@ void paste()
 			if (mused.cp.type == CP_PROGRAM)
 			{
 				snapshot(S_T_INSTRUMENT);
-				cp_paste_items(&mused.cp, CP_PROGRAM, &mused.song.instrument[mused.current_instrument].program[mused.current_program_step], MUS_PROG_LEN - mused.current_program_step, 
-					sizeof(mused.song.instrument[mused.current_instrument].program[0]));
+				
+				MusInstrument inst = mused.song.instrument[mused.current_instrument];
+				cp_paste_items(&mused.cp, CP_PROGRAM, &inst.program[mused.current_program_step], MUS_PROG_LEN - mused.current_program_step, 
+					sizeof(inst.program[0]));
+				
+				cyd_lock(&mused.cyd, 1);
+				mused.song.instrument[mused.current_instrument] = inst;
+				cyd_lock(&mused.cyd, 0);
 			}
 		}
 		break;
@@ -225,8 +261,17 @@ void join_paste()
 			
 			if (items < 1) break;
 			
-			if (mused.cp.type == CP_PATTERNSEGMENT || mused.cp.type == CP_PATTERN)
+			if ((mused.cp.type == CP_PATTERNSEGMENT || mused.cp.type == CP_PATTERN) && current_pattern() != -1)
 			{
+				MusPattern *pattern = &mused.song.pattern[current_pattern()];
+				MusStep *steps = copy_pattern_steps(pattern, pattern->num_steps);
+				
+				if (!steps)
+				{
+					set_info_message("Out of memory!");
+					break;
+				}
+				
 				snapshot(S_T_PATTERN);
 				
 				int ofs;
@@ -236,10 +281,10 @@ void join_paste()
 				else
 					ofs = current_patternstep();
 				
-				for (int i = 0 ; i < items && i + ofs < mused.song.pattern[current_pattern()].num_steps ; ++i)
+				for (int i = 0 ; i < items && i + ofs < pattern->num_steps ; ++i)
 				{
 					const MusStep *s = &((MusStep*)mused.cp.data)[i];
-					MusStep *d = &mused.song.pattern[current_pattern()].step[ofs + i];
+					MusStep *d = &steps[ofs + i];
 					if (s->note != MUS_NOTE_NONE)
 						d->note = s->note;
 						
@@ -255,6 +300,8 @@ void join_paste()
 					if (s->ctrl != 0)
 						d->ctrl = s->ctrl;
 				}
+				
+				swap_pattern_steps(pattern, steps, pattern->num_steps);
 			}
 		}
 		break;
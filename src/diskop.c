@@ -531,6 +531,8 @@ int open_song(FILE *f)
 		memset(mused.song.wavetable_names[i], 0, MUS_WAVETABLE_NAME_LEN + 1);
 	}
 
+	invalidate_wavetable_items(0, CYD_WAVE_MAX_ENTRIES);
+
 	set_channels(mused.song.num_channels);
 
 	return 1;
@@ -0,0 +1,236 @@
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "dspload.h"
+#include "macros.h"
+#include <string.h>
+
+static DspLoad stats;
+static SDL_atomic_t reset_request;
+static Uint64 prev_callback;
+static void *tap;
+static CmdQueue *timed_queue;
+static Uint64 callback_start;
+static int callback_frames;
+static void (*run_timed)(const AudioCmd *cmd);
+static CmdQueue *command_queue;
+static void (*run_command)(const AudioCmd *cmd);
+
+
+static void render(void *udata, Uint8 *stream, int len, Uint64 start)
+{
+	const int frame_size = 2 * sizeof(Sint16);
+	const int frames = len / frame_size;
+	const double freq = SDL_GetPerformanceFrequency();
+	int done = 0;
+	AudioCmd cmd;
+	
+	// The player drains the same queue every tick but the callback can be
+	// disabled (e.g. after MIDI stop) and jamming should still work then
+	
+	if (command_queue && cq_peek(command_queue, &cmd))
+	{
+		cyd_lock(udata, 1);
+		
+		while (cq_pop(command_queue, &cmd))
+			run_command(&cmd);
+		
+		cyd_lock(udata, 0);
+	}
+	
+	while (timed_queue && cq_peek(timed_queue, &cmd))
+	{
+		// Anything that arrived after this callback started belongs to the next buffer
+		
+		if (cmd.time >= start)
+			break;
+		
+		int offset = 0;
+		
+		if (prev_callback != 0 && cmd.time > prev_callback)
+			offset = my_min(frames, (cmd.time - prev_callback) / freq * stats.sample_rate);
+		
+		if (offset > done)
+		{
+			cyd_output_buffer_stereo(udata, stream + done * frame_size, (offset - done) * frame_size);
+			done = offset;
+		}
+		
+		cq_pop(timed_queue, &cmd);
+		
+		cyd_lock(udata, 1);
+		run_timed(&cmd);
+		cyd_lock(udata, 0);
+	}
+	
+	if (done < frames)
+		cyd_output_buffer_stereo(udata, stream + done * frame_size, (frames - done) * frame_size);
+}
+
+
+static void audio_callback(void *udata, Uint8 *stream, int len)
+{
+	const Uint64 start = SDL_GetPerformanceCounter();
+	
+	callback_start = start;
+	callback_frames = len / (2 * sizeof(Sint16));
+	
+	render(udata, stream, len, start);
+	
+	const Uint64 end = SDL_GetPerformanceCounter();
+	const double freq = SDL_GetPerformanceFrequency();
+	const double duration = (double)(len / (2 * sizeof(Sint16))) / stats.sample_rate;
+	const float load = (end - start) / freq / duration;
+	
+	AudioRing *ring = SDL_AtomicGetPtr(&tap);
+	
+	if (ring)
+		ar_push_stereo(ring, (Sint16*)stream, len / (2 * sizeof(Sint16)));
+	
+	if (SDL_AtomicSet(&reset_request, 0))
+	{
+		stats.buffers = stats.xruns = 0;
+		stats.load = stats.peak = stats.max = 0;
+		stats.total_time = 0;
+		memset(stats.histogram, 0, sizeof(stats.histogram));
+		prev_callback = 0;
+		++stats.resets;
+	}
+	
+	// Either we missed the deadline ourselves or the device was starved for
+	// some other reason (callbacks more than two buffers apart)
+	
+	if (load > 1.0f || (prev_callback != 0 && (start - prev_callback) / freq > duration * 2))
+		++stats.xruns;
+	
+	prev_callback = start;
+	
+	++stats.buffers;
+	++stats.histogram[my_min(DL_BINS - 1, (int)(load * 20))];
+	stats.total_time += (end - start) / freq;
+	stats.load = stats.load * 0.9f + load * 0.1f;
+	
+	if (load > stats.max)
+		stats.max = load;
+	
+	if (load >= stats.peak || SDL_GetTicks() - stats.peak_ticks > DL_PEAK_HOLD)
+	{
+		stats.peak = my_max(load, stats.load);
+		stats.peak_ticks = SDL_GetTicks();
+	}
+}
+
+
+bool dl_register(CydEngine *cyd, int buffer_length)
+{
+	SDL_AudioSpec desired;
+	
+	SDL_zero(desired);
+	desired.freq = cyd->sample_rate;
+	desired.format = AUDIO_S16SYS;
+	desired.channels = 2;
+	desired.samples = buffer_length;
+	desired.callback = audio_callback;
+	desired.userdata = cyd;
+	
+	// SDL converts to the device format so the callback gets exactly this
+	
+	if (SDL_OpenAudio(&desired, NULL) < 0)
+	{
+		warning("Could not open audio device: %s", SDL_GetError());
+		return false;
+	}
+	
+	debug("Audio %d Hz/%d samples", desired.freq, desired.samples);
+	
+	stats.sample_rate = desired.freq;
+	stats.buffer_samples = desired.samples;
+	SDL_AtomicSet(&reset_request, 1);
+	
+	SDL_PauseAudio(0);
+	
+	return true;
+}
+
+
+void dl_reset()
+{
+	SDL_AtomicSet(&reset_request, 1);
+}
+
+
+void dl_set_tap(AudioRing *ring)
+{
+	SDL_AtomicSetPtr(&tap, ring);
+}
+
+
+void dl_set_timed_queue(CmdQueue *queue, void (*run)(const AudioCmd *cmd))
+{
+	SDL_LockAudio();
+	run_timed = run;
+	timed_queue = queue;
+	SDL_UnlockAudio();
+}
+
+
+double dl_render_time()
+{
+	// The buffer being rendered plays after the one that is playing now
+	return callback_start / (double)SDL_GetPerformanceFrequency() + callback_frames * 1.5 / stats.sample_rate;
+}
+
+
+void dl_set_command_queue(CmdQueue *queue, void (*run)(const AudioCmd *cmd))
+{
+	SDL_LockAudio();
+	run_command = run;
+	command_queue = queue;
+	SDL_UnlockAudio();
+}
+
+
+const DspLoad * dl_get()
+{
+	return &stats;
+}
+
+
+bool dl_export(FILE *f, const char *title)
+{
+	const DspLoad s = stats;
+	
+	fprintf(f, "# song,%s\n", title);
+	fprintf(f, "# mix_rate,%d\n# buffer_samples,%d\n", s.sample_rate, s.buffer_samples);
+	fprintf(f, "# buffers,%u\n# xruns,%u\n", s.buffers, s.xruns);
+	fprintf(f, "# average_load_percent,%.1f\n", s.buffers && s.sample_rate ? s.total_time * 100.0 / ((double)s.buffers * s.buffer_samples / s.sample_rate) : 0.0);
+	fprintf(f, "# max_load_percent,%.1f\n", s.max * 100.0);
+	fprintf(f, "load_percent,buffers\n");
+	
+	for (int i = 0 ; i < DL_BINS ; ++i)
+		fprintf(f, "%d%s,%u\n", i * 5, i == DL_BINS - 1 ? "+" : "", s.histogram[i]);
+	
+	return !ferror(f);
+}
@@ -0,0 +1,77 @@
+#ifndef DSPLOAD_H
+#define DSPLOAD_H
+
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SDL.h"
+#include "snd/cyd.h"
+#include "audioring.h"
+#include "cmdqueue.h"
+#include <stdio.h>
+#include <stdbool.h>
+
+/*
+Times every audio callback against the length of the buffer it fills.
+The audio thread is the only writer, the UI reads the numbers without
+locking since they are only displayed.
+*/
+
+#define DL_BINS 21 // 5% each, the last one is everything over 100%
+#define DL_PEAK_HOLD 2000 // ms
+
+typedef struct
+{
+	int sample_rate, buffer_samples;
+	Uint32 buffers, xruns;
+	Uint32 resets; // times the counters above were cleared
+	Uint32 histogram[DL_BINS];
+	float load; // smoothed render time / buffer time
+	float peak;
+	float max; // since reset
+	double total_time; // seconds spent rendering
+	Uint32 peak_ticks;
+} DspLoad;
+
+/* Replaces cyd_register(), the device is still closed with cyd_unregister() */
+bool dl_register(CydEngine *cyd, int buffer_length);
+/* Clears the counters on the next callback */
+void dl_reset();
+/* Also copy the output to ring (NULL to stop), outside the timed part */
+void dl_set_tap(AudioRing *ring);
+/*
+Timed commands (AudioCmd.time set) from queue are run inside the buffer at
+the offset where they arrived during the previous buffer, so they all get
+exactly one buffer of latency instead of jittering with the callback
+*/
+void dl_set_timed_queue(CmdQueue *queue, void (*run)(const AudioCmd *cmd));
+/* Untimed commands from queue are run at the start of every buffer */
+void dl_set_command_queue(CmdQueue *queue, void (*run)(const AudioCmd *cmd));
+/* Audio thread, when the middle of the buffer being rendered will be heard (seconds on the performance counter) */
+double dl_render_time();
+const DspLoad * dl_get();
+bool dl_export(FILE *f, const char *title);
+
+#endif
@@ -28,6 +28,7 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "mused.h"
 #include "gui/msgbox.h"
 #include "view/wavetableview.h"
+#include "usage.h"
 #include <string.h>
 
 extern Mused mused;
@@ -35,28 +36,10 @@ extern GfxDomain *domain;
 
 static int find_unused_pattern()
 {
-	for (int empty = 0 ; empty < NUM_PATTERNS ; ++empty)
-	{
-		int not_empty = 0;
-		for (int s = 0 ; s < mused.song.pattern[empty].num_steps && !not_empty ; ++s)
-			if ((empty == current_pattern() && mused.focus == EDITPATTERN) || (mused.song.pattern[empty].step[s].note != MUS_NOTE_NONE
-				|| mused.song.pattern[empty].step[s].ctrl != 0
-				|| mused.song.pattern[empty].step[s].instrument != MUS_NOTE_NO_INSTRUMENT
-				|| mused.song.pattern[empty].step[s].command != 0))
-				not_empty = 1;
-
-		for (int c = 0 ; c < mused.song.num_channels && !not_empty ; ++c)
-		{
-			for (int i = 0 ; i < mused.song.num_sequences[c] && !not_empty ; ++i)
-			{
-				if (mused.song.sequence[c][i].pattern == empty)
-					not_empty = 1;
-			}
-		}
+	int empty = usage_find_unused_pattern(&mused.song, mused.focus == EDITPATTERN ? current_pattern() : -1);
 
-		if (!not_empty)
-			return empty;
-	}
+	if (empty != -1)
+		return empty;
 
 	msgbox(domain, mused.slider_bevel, &mused.largefont, "Max patterns exceeded!", MB_OK);
 
@@ -94,12 +77,17 @@ void clone_pattern(void *unused1, void *unused2, void *unused3)
 		return;
 	}
 
-	mused.song.pattern[empty].color = mused.song.pattern[cp].color;
+	MusStep *steps = copy_pattern_steps(&mused.song.pattern[cp], mused.song.pattern[cp].num_steps);
 
-	resize_pattern(&mused.song.pattern[empty], mused.song.pattern[cp].num_steps);
+	if (!steps)
+	{
+		set_info_message("Out of memory!");
+		return;
+	}
+
+	mused.song.pattern[empty].color = mused.song.pattern[cp].color;
 
-	memcpy(mused.song.pattern[empty].step, mused.song.pattern[cp].step,
-		mused.song.pattern[cp].num_steps * sizeof(mused.song.pattern[cp].step[0]));
+	swap_pattern_steps(&mused.song.pattern[empty], steps, mused.song.pattern[cp].num_steps);
 
 	set_pattern(empty);
 
@@ -188,28 +176,27 @@ void expand_pattern(void *factor, void *unused2, void *unused3)
 	if (!pattern)
 		return;
 
-	MusStep *temp = malloc(pattern->num_steps * sizeof(pattern->step[0]));
-	memcpy(temp, pattern->step, pattern->num_steps * sizeof(pattern->step[0]));
+	const Uint16 num_steps = pattern->num_steps * CASTPTR(int,factor);
+	MusStep *steps = copy_pattern_steps(NULL, num_steps);
 
-	snapshot(S_T_PATTERN);
-
-	resize_pattern(pattern, pattern->num_steps * CASTPTR(int,factor));
-
-	for (int i = 0 ; i < pattern->num_steps ; ++i)
+	if (!steps)
 	{
-		zero_step(&pattern->step[i]);
+		set_info_message("Out of memory!");
+		return;
 	}
 
-	for (int i = 0, ti = 0 ; i < pattern->num_steps ; ++i)
+	snapshot(S_T_PATTERN);
+
+	for (int i = 0, ti = 0 ; i < num_steps ; ++i)
 	{
 		if ((i % CASTPTR(int,factor)) == 0)
 		{
-			memcpy(&pattern->step[i], &temp[ti], sizeof(pattern->step[i]));
+			memcpy(&steps[i], &pattern->step[ti], sizeof(steps[i]));
 			++ti;
 		}
 	}
 
-	free(temp);
+	swap_pattern_steps(pattern, steps, num_steps);
 }
 
 
@@ -224,14 +211,23 @@ void shrink_pattern(void *factor, void *unused2, void *unused3)
 
 	if (pattern->num_steps <= CASTPTR(int,factor)) return;
 
-	snapshot(S_T_PATTERN);
+	const int num_steps = pattern->num_steps / CASTPTR(int,factor);
+	MusStep *steps = copy_pattern_steps(NULL, num_steps);
+
+	if (!steps)
+	{
+		set_info_message("Out of memory!");
+		return;
+	}
 
-	resize_pattern(pattern, pattern->num_steps / CASTPTR(int,factor));
+	snapshot(S_T_PATTERN);
 
-	for (int i = 0, ti = 0 ; i < pattern->num_steps ; ++i, ti += CASTPTR(int,factor))
+	for (int i = 0, ti = 0 ; i < num_steps ; ++i, ti += CASTPTR(int,factor))
 	{
-		memcpy(&pattern->step[i], &pattern->step[ti], sizeof(pattern->step[i]));
+		memcpy(&steps[i], &pattern->step[ti], sizeof(steps[i]));
 	}
+
+	swap_pattern_steps(pattern, steps, num_steps);
 }
 
 
@@ -324,6 +320,8 @@ void snapshot_cascade(SHType type, int a, int b)
 		}
 	}
 
+	usage_invalidate();
+
 	mused.last_snapshot = type;
 	mused.last_snapshot_a = a;
 	mused.last_snapshot_b = b;
@@ -333,6 +331,33 @@ void snapshot_cascade(SHType type, int a, int b)
 }
 
 
+void snapshot_wave_range(int idx, int first, int length, const Sint16 *original, bool modified)
+{
+	undo_store_wave_range(&mused.undo, idx, first, length, original, modified);
+
+	mused.last_snapshot = S_T_WAVE_DATA;
+	mused.last_snapshot_a = -1;
+	mused.last_snapshot_b = -1;
+	mused.modified = true;
+}
+
+
+bool snapshot_wave_batch(int first, int count)
+{
+	if (!undo_store_wave_batch(&mused.undo, first, count, &mused.mus.cyd->wavetable_entries[first], mused.modified))
+		return false;
+
+	usage_invalidate();
+
+	mused.last_snapshot = S_T_WAVE_DATA;
+	mused.last_snapshot_a = -1;
+	mused.last_snapshot_b = -1;
+	mused.modified = true;
+	
+	return true;
+}
+
+
 void transpose_note_data(void *semitones, void *unused1, void *unused2)
 {
 	if (mused.focus != EDITPATTERN || mused.selection.start >= mused.selection.end)
@@ -391,6 +416,15 @@ void split_pattern(void *unused1, void *unused2, void *unused3)
 
 	int cp = current_pattern();
 	MusPattern *new_pattern = &mused.song.pattern[empty];
+	MusStep *steps = copy_pattern_steps(NULL, pat->num_steps - step);
+
+	if (!steps)
+	{
+		set_info_message("Out of memory!");
+		return;
+	}
+
+	memcpy(steps, &pat->step[step], sizeof(pat->step[0]) * ((int)pat->num_steps - step));
 
 	// Add new pattern in sequence
 
@@ -400,8 +434,7 @@ void split_pattern(void *unused1, void *unused2, void *unused3)
 	// Copy latter half to the new pattern
 
 	snapshot(S_T_PATTERN);
-	resize_pattern(new_pattern, pat->num_steps - step);
-	memcpy(new_pattern->step, &pat->step[step], sizeof(pat->step[0]) * ((int)pat->num_steps - step));
+	swap_pattern_steps(new_pattern, steps, pat->num_steps - step);
 
 	// Resize old pattern
 
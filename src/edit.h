@@ -45,6 +45,11 @@ typedef enum
 /* a, b = id for cascading snapshots */
 void snapshot(SHType type);
 void snapshot_cascade(SHType type, int a, int b);
+/* For edits that keep their own copy of the changed samples, see undo_store_wave_range() */
+void snapshot_wave_range(int idx, int first, int length, const Sint16 *original, bool modified);
+/* Call before replacing items first..first + count - 1 in one go */
+/* Returns false if the undo frame couldn't be stored, nothing should be changed then */
+bool snapshot_wave_batch(int first, int count);
 
 void zero_step(MusStep *step);
 void clone_pattern(void *, void *, void *);
@@ -556,48 +556,107 @@ void instrument_add_param(int a)
 }
 
 
+// Jamming goes through mused.cmdq so the UI never has to lock the player
+
 static int note_playing[MUS_MAX_CHANNELS] = {-1};
 
 
-static int find_playing_note(int n)
+static int find_playing_note(int n, const MusInstrument *instrument)
 {
-	cyd_lock(&mused.cyd, 1);
-
 	for (int i = 0 ; i < MUS_MAX_CHANNELS && i < mused.cyd.n_channels ; ++i)
 	{
-		if (note_playing[i] == n && mused.mus.channel[i].instrument == &mused.song.instrument[mused.current_instrument])
+		if (note_playing[i] == n && mused.mus.channel[i].instrument == instrument)
 		{
-			cyd_lock(&mused.cyd, 0);
 			return i;
 		}
 	}
 
-	cyd_lock(&mused.cyd, 0);
-
 	return -1;
 }
 
 
-static void play_note(int note) {
-	if (find_playing_note(note) == -1 && note < FREQ_TAB_SIZE)
+static int trigger(int chn, MusInstrument *instrument, int note)
+{
+	int c = mus_trigger_instrument(&mused.mus, chn, instrument, note << 8, CYD_PAN_CENTER);
+
+	mused.mus.song_track[c].extarp1 = 0;
+	mused.mus.song_track[c].extarp2 = 0;
+
+	return c;
+}
+
+
+void run_audio_command(const AudioCmd *cmd)
+{
+	switch (cmd->type)
 	{
-		int c = mus_trigger_instrument(&mused.mus, -1, &mused.song.instrument[mused.current_instrument], note << 8, CYD_PAN_CENTER);
-		note_playing[c] = note;
+		case CQ_NOTE_ON:
+		{
+			MusInstrument *instrument = &mused.song.instrument[cmd->param];
+
+			if (find_playing_note(cmd->note, instrument) == -1 && cmd->note < FREQ_TAB_SIZE)
+				note_playing[trigger(-1, instrument, cmd->note)] = cmd->note;
+		}
+		break;
+
+		case CQ_NOTE_OFF:
+		{
+			int c;
+
+			if ((c = find_playing_note(cmd->note, &mused.song.instrument[cmd->param])) != -1)
+			{
+				mus_release(&mused.mus, c);
+				note_playing[c] = -1;
+			}
+		}
+		break;
+
+		case CQ_TRIGGER:
+			trigger(cmd->channel, &mused.song.instrument[cmd->param], cmd->note);
+			break;
 
-		mused.mus.song_track[c].extarp1 = 0;
-		mused.mus.song_track[c].extarp2 = 0;
+		case CQ_TRIGGER_WAVE:
+		{
+			static MusInstrument inst;
+			mus_get_default_instrument(&inst);
+			inst.wavetable_entry = cmd->param;
+			inst.cydflags &= ~WAVEFORMS;
+			inst.cydflags |= CYD_CHN_WAVE_OVERRIDE_ENV | CYD_CHN_ENABLE_WAVE;
+			inst.flags &= ~MUS_INST_DRUM;
+			mus_trigger_instrument(&mused.mus, cmd->channel, &inst, cmd->note << 8, CYD_PAN_CENTER);
+		}
+		break;
+
+		case CQ_GATE_OFF:
+			for (int i = 0 ; i < MUS_MAX_CHANNELS ; ++i)
+				cyd_enable_gate(mused.mus.cyd, &mused.mus.cyd->channel[i], 0);
+			break;
+
+		case CQ_EXT_SYNC:
+			if (mused.mus.flags & MUS_EXT_SYNC)
+				mus_ext_sync(&mused.mus);
+			break;
 	}
 }
 
 
+static void send_audio_command(CqType type, int chn, int note, int param)
+{
+	AudioCmd cmd = { type, chn, note, param };
+
+	if (!cq_push(&mused.cmdq, &cmd))
+		debug("Audio command queue full");
+}
+
+
+static void play_note(int note) {
+	send_audio_command(CQ_NOTE_ON, -1, note, mused.current_instrument);
+}
+
+
 static void stop_note(int note)
 {
-	int c;
-	if ((c = find_playing_note(note)) != -1)
-	{
-		mus_release(&mused.mus, c);
-		note_playing[c] = -1;
-	}
+	send_audio_command(CQ_NOTE_OFF, -1, note, mused.current_instrument);
 }
 
 
@@ -605,8 +664,7 @@ static void play_the_jams(int sym, int chn, int state)
 {
 	if (sym == SDLK_SPACE && state == 0)
 	{
-		for (int i = 0 ; i < MUS_MAX_CHANNELS ; ++i)
-			cyd_enable_gate(mused.mus.cyd, &mused.mus.cyd->channel[i], 0);
+		send_audio_command(CQ_GATE_OFF, -1, 0, 0);
 	}
 	else
 	{
@@ -627,10 +685,7 @@ static void play_the_jams(int sym, int chn, int state)
 					if (chn == -1 && !(mused.flags & MULTICHANNEL_PREVIEW))
 						chn = 0;
 
-					int c = mus_trigger_instrument(&mused.mus, chn, &mused.song.instrument[mused.current_instrument], note << 8, CYD_PAN_CENTER);
-
-					mused.mus.song_track[c].extarp1 = 0;
-					mused.mus.song_track[c].extarp2 = 0;
+					send_audio_command(CQ_TRIGGER, chn, note, mused.current_instrument);
 				}
 			}
 		}
@@ -643,21 +698,14 @@ static void wave_the_jams(int sym)
 {
 	if (sym == SDLK_SPACE)
 	{
-		for (int i = 0 ; i < MUS_MAX_CHANNELS ; ++i)
-			cyd_enable_gate(mused.mus.cyd, &mused.mus.cyd->channel[i], 0);
+		send_audio_command(CQ_GATE_OFF, -1, 0, 0);
 	}
 	else
 	{
 		int note = find_note(sym, mused.octave);
 		if (note != -1)
 		{
-			static MusInstrument inst;
-			mus_get_default_instrument(&inst);
-			inst.wavetable_entry = mused.selected_wavetable;
-			inst.cydflags &= ~WAVEFORMS;
-			inst.cydflags |= CYD_CHN_WAVE_OVERRIDE_ENV | CYD_CHN_ENABLE_WAVE;
-			inst.flags &= ~MUS_INST_DRUM;
-			mus_trigger_instrument(&mused.mus, 0, &inst, note << 8, CYD_PAN_CENTER);
+			send_audio_command(CQ_TRIGGER_WAVE, 0, note, mused.selected_wavetable);
 		}
 	}
 }
@@ -788,6 +836,22 @@ static int seqsort(const void *_a, const void *_b)
 }
 
 
+// The player walks the sequence while it is edited so edits that move items
+// build the new sequence in a copy and only copying it back is locked
+
+void set_sequence(int channel, const MusSeqPattern *seq, int n_seq)
+{
+	cyd_lock(&mused.cyd, 1);
+
+	if (n_seq > 0)
+		memcpy(mused.song.sequence[channel], seq, n_seq * sizeof(seq[0]));
+
+	mused.song.num_sequences[channel] = n_seq;
+
+	cyd_lock(&mused.cyd, 0);
+}
+
+
 void add_sequence(int channel, int position, int pattern, int offset)
 {
 	if(mused.song.pattern[pattern].num_steps == 0)
@@ -804,13 +868,18 @@ void add_sequence(int channel, int position, int pattern, int offset)
 	if (mused.song.num_sequences[channel] >= NUM_SEQUENCES)
 		return;
 
-	mused.song.sequence[channel][mused.song.num_sequences[channel]].position = position;
-	mused.song.sequence[channel][mused.song.num_sequences[channel]].pattern = pattern;
-	mused.song.sequence[channel][mused.song.num_sequences[channel]].note_offset = offset;
+	MusSeqPattern seq[NUM_SEQUENCES];
+	const int n_seq = mused.song.num_sequences[channel] + 1;
+
+	memcpy(seq, mused.song.sequence[channel], (n_seq - 1) * sizeof(seq[0]));
+
+	seq[n_seq - 1].position = position;
+	seq[n_seq - 1].pattern = pattern;
+	seq[n_seq - 1].note_offset = offset;
 
-	++mused.song.num_sequences[channel];
+	qsort(seq, n_seq, sizeof(seq[0]), seqsort);
 
-	qsort(mused.song.sequence[channel], mused.song.num_sequences[channel], sizeof(mused.song.sequence[channel][0]), seqsort);
+	set_sequence(channel, seq, n_seq);
 }
 
 
@@ -830,15 +899,35 @@ void del_sequence(int first,int last,int track)
 {
 	if (mused.song.num_sequences[track] == 0) return;
 
-	for (int i = 0 ; i < mused.song.num_sequences[mused.current_sequencetrack] ; ++i)
-		if (mused.song.sequence[track][i].position >= first && mused.song.sequence[track][i].position < last)
+	// The sequence is sorted so dropping items keeps it sorted
+
+	MusSeqPattern seq[NUM_SEQUENCES];
+	int n_seq = 0;
+
+	for (int i = 0 ; i < mused.song.num_sequences[track] ; ++i)
+		if (mused.song.sequence[track][i].position < first || mused.song.sequence[track][i].position >= last)
 		{
-			mused.song.sequence[track][i].position = 0xffff;
+			seq[n_seq++] = mused.song.sequence[track][i];
 		}
 
-	qsort(mused.song.sequence[track], mused.song.num_sequences[track], sizeof(mused.song.sequence[track][0]), seqsort);
+	set_sequence(track, seq, n_seq);
+}
+
+
+static void shift_sequence(int track, int from, int delta)
+{
+	MusSeqPattern seq[NUM_SEQUENCES];
+	const int n_seq = mused.song.num_sequences[track];
+
+	memcpy(seq, mused.song.sequence[track], n_seq * sizeof(seq[0]));
+
+	for (int i = 0 ; i < n_seq ; ++i)
+	{
+		if (seq[i].position >= from)
+			seq[i].position += delta;
+	}
 
-	while (mused.song.num_sequences[track] > 0 && mused.song.sequence[track][mused.song.num_sequences[track]-1].position == 0xffff) --mused.song.num_sequences[track];
+	set_sequence(track, seq, n_seq);
 }
 
 
@@ -1016,11 +1105,7 @@ void sequence_event(SDL_Event *e)
 			{
 				snapshot(S_T_SEQUENCE);
 
-				for (int i = 0; i < mused.song.num_sequences[mused.current_sequencetrack] ; ++i)
-				{
-					if (mused.song.sequence[mused.current_sequencetrack][i].position >= mused.current_sequencepos)
-						mused.song.sequence[mused.current_sequencetrack][i].position += mused.sequenceview_steps;
-				}
+				shift_sequence(mused.current_sequencetrack, mused.current_sequencepos, mused.sequenceview_steps);
 			}
 			break;
 
@@ -1041,13 +1126,7 @@ void sequence_event(SDL_Event *e)
 				del_sequence(mused.current_sequencepos, mused.current_sequencepos+mused.sequenceview_steps, mused.current_sequencetrack);
 
 				if (!(mused.flags & DELETE_EMPTIES))
-				{
-					for (int i = 0; i < mused.song.num_sequences[mused.current_sequencetrack] ; ++i)
-					{
-						if (mused.song.sequence[mused.current_sequencetrack][i].position >= mused.current_sequencepos)
-							mused.song.sequence[mused.current_sequencetrack][i].position -= mused.sequenceview_steps;
-					}
-				}
+					shift_sequence(mused.current_sequencetrack, mused.current_sequencepos, -mused.sequenceview_steps);
 			}
 			break;
 
@@ -1288,15 +1367,25 @@ void pattern_event(SDL_Event *e)
 
 					if ((e->key.keysym.mod & KMOD_ALT))
 					{
+						// The added step comes cleared
 						resize_pattern(get_current_pattern(), get_current_pattern()->num_steps + 1);
-						zero_step(&mused.song.pattern[current_pattern()].step[mused.song.pattern[current_pattern()].num_steps - 1]);
 						break;
 					}
 
-					for (int i = mused.song.pattern[current_pattern()].num_steps-1; i >= current_patternstep() ; --i)
-						memcpy(&mused.song.pattern[current_pattern()].step[i], &mused.song.pattern[current_pattern()].step[i-1], sizeof(mused.song.pattern[current_pattern()].step[0]));
+					MusPattern *pattern = get_current_pattern();
+					MusStep *steps = copy_pattern_steps(pattern, pattern->num_steps);
+
+					if (!steps)
+					{
+						set_info_message("Out of memory!");
+						break;
+					}
+
+					memmove(&steps[current_patternstep() + 1], &steps[current_patternstep()], sizeof(steps[0]) * (pattern->num_steps - 1 - current_patternstep()));
+
+					zero_step(&steps[current_patternstep()]);
 
-					zero_step(&mused.song.pattern[current_pattern()].step[current_patternstep()]);
+					swap_pattern_steps(pattern, steps, pattern->num_steps);
 				}
 			}
 			break;
@@ -1328,10 +1417,20 @@ void pattern_event(SDL_Event *e)
 
 					if (!(mused.flags & DELETE_EMPTIES) || e->key.keysym.sym == SDLK_BACKSPACE)
 					{
-						for (int i = current_patternstep()  ; i < mused.song.pattern[current_pattern()].num_steps ; ++i)
-							memcpy(&mused.song.pattern[current_pattern()].step[i], &mused.song.pattern[current_pattern()].step[i+1], sizeof(mused.song.pattern[current_pattern()].step[0]));
+						MusPattern *pattern = &mused.song.pattern[current_pattern()];
+						MusStep *steps = copy_pattern_steps(pattern, pattern->num_steps);
 
-						zero_step(&mused.song.pattern[current_pattern()].step[mused.song.pattern[current_pattern()].num_steps - 1]);
+						if (!steps)
+						{
+							set_info_message("Out of memory!");
+							break;
+						}
+
+						memmove(&steps[current_patternstep()], &steps[current_patternstep() + 1], sizeof(steps[0]) * (pattern->num_steps - 1 - current_patternstep()));
+
+						zero_step(&steps[pattern->num_steps - 1]);
+
+						swap_pattern_steps(pattern, steps, pattern->num_steps);
 
 						if (current_patternstep() >= mused.song.pattern[current_pattern()].num_steps) --mused.current_patternpos;
 					}
@@ -1779,9 +1878,17 @@ void edit_program_event(SDL_Event *e)
 			case SDLK_INSERT:
 			{
 				snapshot(S_T_INSTRUMENT);
+
+				// Shifted in a copy so the player never sees a step twice
+
+				MusInstrument inst = mused.song.instrument[mused.current_instrument];
 				for (int i = MUS_PROG_LEN-1; i > mused.current_program_step ; --i)
-					mused.song.instrument[mused.current_instrument].program[i] = mused.song.instrument[mused.current_instrument].program[i-1];
-				mused.song.instrument[mused.current_instrument].program[mused.current_program_step] = MUS_FX_NOP;
+					inst.program[i] = inst.program[i-1];
+				inst.program[mused.current_program_step] = MUS_FX_NOP;
+
+				cyd_lock(&mused.cyd, 1);
+				mused.song.instrument[mused.current_instrument] = inst;
+				cyd_lock(&mused.cyd, 0);
 			}
 			break;
 
@@ -1797,9 +1904,14 @@ void edit_program_event(SDL_Event *e)
 
 				if (!(mused.flags & DELETE_EMPTIES) || e->key.keysym.sym == SDLK_BACKSPACE)
 				{
+					MusInstrument inst = mused.song.instrument[mused.current_instrument];
 					for (int i = mused.current_program_step  ; i < MUS_PROG_LEN-1 ; ++i)
-						mused.song.instrument[mused.current_instrument].program[i] = mused.song.instrument[mused.current_instrument].program[i+1];
-					mused.song.instrument[mused.current_instrument].program[MUS_PROG_LEN-1] = MUS_FX_NOP;
+						inst.program[i] = inst.program[i+1];
+					inst.program[MUS_PROG_LEN-1] = MUS_FX_NOP;
+
+					cyd_lock(&mused.cyd, 1);
+					mused.song.instrument[mused.current_instrument] = inst;
+					cyd_lock(&mused.cyd, 0);
 				}
 				else
 				{
@@ -2459,7 +2571,10 @@ void note_event(SDL_Event *e)
 	{
 		case MSG_NOTEON:
 		{
-			play_note(e->user.code);
+			// data2 is set if the note was already sent to the audio thread
+			if (!e->user.data2)
+				play_note(e->user.code);
+
 			if (mused.focus == EDITPATTERN && (mused.flags & EDIT_MODE) && get_current_step() && mused.current_patternx == PED_NOTE)
 			{
 				write_note(e->user.code);
@@ -2469,7 +2584,8 @@ void note_event(SDL_Event *e)
 
 		case MSG_NOTEOFF:
 		{
-			stop_note(e->user.code);
+			if (!e->user.data2)
+				stop_note(e->user.code);
 		}
 		break;
 
@@ -28,6 +28,8 @@ OTHER DEALINGS IN THE SOFTWARE.
 
 #include "SDL.h"
 #include "gui/slider.h"
+#include "cmdqueue.h"
+#include "snd/music.h"
 
 void edit_instrument_event(SDL_Event *e);
 void sequence_event(SDL_Event *e);
@@ -42,12 +44,15 @@ void wave_add_param(int d);
 void songinfo_event(SDL_Event *e);
 void songinfo_add_param(int d);
 void instrument_add_param(int a);
+void set_sequence(int channel, const MusSeqPattern *seq, int n_seq);
 void del_sequence(int first,int last,int track);
 void add_sequence(int channel, int position, int pattern, int offset);
 void set_room_size(int fx, int size, int vol, int dec);
 void update_position_sliders();
 void update_horiz_sliders();
 void note_event(SDL_Event *e);
+/* Audio thread side of the jamming commands */
+void run_audio_command(const AudioCmd *cmd);
 
 enum
 {
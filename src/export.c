@@ -31,99 +31,221 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "gfx/font.h"
 #include "theme.h"
 #include <string.h>
+#include <stdlib.h>
 #include "wavewriter.h"
+#include "view.h"
+#include "workpool.h"
 
 extern GfxDomain *domain;
 
-bool export_wav(MusSong *song, CydWavetableEntry * entry, FILE *f, int channel)
+#define EXPORT_BLOCK 2000
+
+typedef struct
 {
-	bool success = false;
-	
 	MusEngine mus;
 	CydEngine cyd;
-	
-	cyd_init(&cyd, 44100, MUS_MAX_CHANNELS);
-	cyd.flags |= CYD_SINGLE_THREAD;
-	mus_init_engine(&mus, &cyd);
-	mus.volume = song->master_volume;
-	mus_set_fx(&mus, song);
-	CydWavetableEntry * prev_entry = cyd.wavetable_entries; // save entries so they can be free'd
-	cyd.wavetable_entries = entry;
-	cyd_set_callback(&cyd, mus_advance_tick, &mus, song->song_rate);
-	mus_set_song(&mus, song, 0);
-	song->flags |= MUS_NO_REPEAT;
+	const MusSong *song;
+	CydWavetableEntry *prev_entry;
+	WaveWriter *ww;
+	Sint16 buffer[EXPORT_BLOCK * 2];
+	int samples;
+	bool done;
+} ExportTrack;
+
+
+static void export_init(ExportTrack *track, MusSong *song, CydWavetableEntry * entry, FILE *f, int channel)
+{
+	cyd_init(&track->cyd, 44100, MUS_MAX_CHANNELS);
+	track->cyd.flags |= CYD_SINGLE_THREAD;
+	mus_init_engine(&track->mus, &track->cyd);
+	track->mus.volume = song->master_volume;
+	mus_set_fx(&track->mus, song);
+	track->prev_entry = track->cyd.wavetable_entries; // save entries so they can be free'd
+	track->cyd.wavetable_entries = entry;
+	cyd_set_callback(&track->cyd, mus_advance_tick, &track->mus, song->song_rate);
+	mus_set_song(&track->mus, song, 0);
 	
 	if (channel >= 0)
 	{
 		// if channel is positive then only export that channel (mute other chans)
 		
 		for (int i = 0 ; i < MUS_MAX_CHANNELS ; ++i)
-			mus.channel[i].flags |= MUS_CHN_DISABLED;
+			track->mus.channel[i].flags |= MUS_CHN_DISABLED;
 		
-		mus.channel[channel].flags &= ~MUS_CHN_DISABLED;
+		track->mus.channel[channel].flags &= ~MUS_CHN_DISABLED;
 	}
 	else
 	{
 		for (int i = 0 ; i < MUS_MAX_CHANNELS ; ++i)
-			mus.channel[i].flags &= ~MUS_CHN_DISABLED;
+			track->mus.channel[i].flags &= ~MUS_CHN_DISABLED;
 	}
 	
-	const int channels = 2;
-	Sint16 buffer[2000 * channels];
+	track->song = song;
+	track->ww = ww_create(f, track->cyd.sample_rate, 2);
+	track->samples = 0;
+	track->done = false;
+}
+
+
+static void export_render(ExportTrack *track)
+{
+	memset(track->buffer, 0, sizeof(track->buffer)); // Zero the input to cyd
+	cyd_output_buffer_stereo(&track->cyd, (Uint8*)track->buffer, sizeof(track->buffer));
+	
+	track->samples = track->cyd.samples_output;
+	track->done = track->mus.song_position >= track->song->song_length;
+}
+
+
+static void export_deinit(ExportTrack *track)
+{
+	ww_finish(track->ww);
+	
+	track->cyd.wavetable_entries = track->prev_entry;
 	
-	int last_percentage = -1;
+	cyd_deinit(&track->cyd);
+}
+
+
+bool export_wav(MusSong *song, CydWavetableEntry * entry, FILE *f, int channel)
+{
+	bool success = false;
 	
-	WaveWriter *ww = ww_create(f, cyd.sample_rate, 2);
+	ExportTrack *track = malloc(sizeof(*track));
+	
+	if (!track)
+	{
+		// The caller expects the file to be closed like ww_finish() does
+		fclose(f);
+		set_info_message("Out of memory!");
+		return false;
+	}
+	
+	export_init(track, song, entry, f, channel);
+	song->flags |= MUS_NO_REPEAT;
+	
+	int last_percentage = -1;
 	
 	for (;;)
 	{
-		memset(buffer, 0, sizeof(buffer)); // Zero the input to cyd
-		cyd_output_buffer_stereo(&cyd, (Uint8*)buffer, sizeof(buffer));
+		export_render(track);
 		
-		if (cyd.samples_output > 0)
-			ww_write(ww, buffer, cyd.samples_output);
+		if (track->samples > 0)
+			ww_write(track->ww, track->buffer, track->samples);
 		
-		if (mus.song_position >= song->song_length) break;
+		if (track->done) break;
 		
 		if (song->song_length != 0)
 		{
-			int percentage = (mus.song_position + (channel == -1 ? 0 : (channel * song->song_length))) * 100 / (song->song_length * (channel == -1 ? 1 : song->num_channels));
+			int percentage = track->mus.song_position * 100 / song->song_length;
 			
 			if (percentage > last_percentage)
 			{
 				last_percentage = percentage;
 				
-				SDL_Rect area = {domain->screen_w / 2 - 140, domain->screen_h / 2 - 24, 280, 48};
-				bevel(domain, &area, mused.slider_bevel, BEV_MENU);
-				
-				adjust_rect(&area, 8);
-				area.h = 16;
-				
-				bevel(domain, &area, mused.slider_bevel, BEV_FIELD);
-				
-				adjust_rect(&area, 2);
-				
-				int t = area.w;
-				area.w = area.w * percentage / 100;
-				
-				gfx_rect(domain, &area, colors[COLOR_PROGRESS_BAR]);
-				
-				area.y += 16 + 4 + 4;
-				area.w = t;
-				
-				font_write_args(&mused.smallfont, domain, &area, "Exporting... Press ESC to abort.");
-				
-				SDL_Event e;
-				
-				while (SDL_PollEvent(&e))
+				if (!progress_box("Exporting...", percentage, 100))
 				{
-					if (e.type == SDL_QUIT || (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_ESCAPE))
-					{
-						goto abort;
-					}
+					goto abort;
 				}
+			}
+		}
+	}
+	
+	success = true;
+	
+abort:;
+	
+	export_deinit(track);
+	free(track);
+	
+	song->flags &= ~MUS_NO_REPEAT;
+	
+	return success;
+}
+
+
+static void render_track_job(void *param, int index)
+{
+	ExportTrack *track = &((ExportTrack*)param)[index];
+	
+	if (track->ww && !track->done)
+		export_render(track);
+}
+
+
+bool export_channels(MusSong *song, CydWavetableEntry * entry, FILE **f, int count)
+{
+	bool success = false;
+	
+	ExportTrack *track = calloc(count, sizeof(*track));
+	
+	if (!track)
+	{
+		for (int i = 0 ; i < count ; ++i)
+			if (f[i]) fclose(f[i]);
+		
+		set_info_message("Out of memory!");
+		return false;
+	}
+	
+	for (int i = 0 ; i < count ; ++i)
+	{
+		if (f[i])
+			export_init(&track[i], song, entry, f[i], i);
+		else
+			track[i].done = true;
+	}
+	
+	song->flags |= MUS_NO_REPEAT;
+	
+	// Every track is a private engine so they can render side by side, the
+	// blocks are written in order after each join. The engines are set up
+	// above on this thread so any global tables klystron fills in exist
+	// before the workers start. This assumes the engine only reads global
+	// state while rendering.
+	//
+	// Only the offline export is split up. The live mixer renders all
+	// channels in one cyd_output_buffer_stereo() call and stays serial.
+	
+	WorkPool pool;
+	wp_init(&pool, count);
+	
+	int last_percentage = -1;
+	
+	for (;;)
+	{
+		wp_run(&pool, render_track_job, track, count);
+		
+		bool done = true;
+		int position = song->song_length;
+		
+		for (int i = 0 ; i < count ; ++i)
+		{
+			if (!track[i].ww)
+				continue;
+			
+			if (track[i].samples > 0)
+				ww_write(track[i].ww, track[i].buffer, track[i].samples);
+			
+			track[i].samples = 0;
+			done &= track[i].done;
+			position = my_min(position, track[i].mus.song_position);
+		}
+		
+		if (done) break;
+		
+		if (song->song_length != 0)
+		{
+			int percentage = position * 100 / song->song_length;
+			
+			if (percentage > last_percentage)
+			{
+				last_percentage = percentage;
 				
-				gfx_domain_flip(domain);
+				if (!progress_box("Exporting...", percentage, 100))
+				{
+					goto abort;
+				}
 			}
 		}
 	}
@@ -132,13 +254,17 @@ bool export_wav(MusSong *song, CydWavetableEntry * entry, FILE *f, int channel)
 	
 abort:;
 	
-	ww_finish(ww);
+	wp_deinit(&pool);
 	
-	cyd.wavetable_entries = prev_entry;
+	for (int i = 0 ; i < count ; ++i)
+	{
+		if (track[i].ww)
+			export_deinit(&track[i]);
+	}
 	
-	cyd_deinit(&cyd);
+	free(track);
 	
 	song->flags &= ~MUS_NO_REPEAT;
 	
 	return success;
-}
\ No newline at end of file
+}
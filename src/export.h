@@ -29,5 +29,7 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "snd/music.h"
 
 bool export_wav(MusSong *song, CydWavetableEntry * entry, FILE *f, int channel);
+/* Exports channel i to f[i] (skipped if NULL), the channels are rendered in parallel */
+bool export_channels(MusSong *song, CydWavetableEntry * entry, FILE **f, int count);
 
 #endif
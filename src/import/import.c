@@ -36,6 +36,7 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "diskop.h"
 #include "SDL_endian.h"
 #include "action.h"
+#include "view/wavetableview.h"
 #include "optimize.h"
 
 
@@ -101,6 +102,8 @@ void import_module(void *type, void* unused1, void* unused2)
 	
 	fclose(f);
 	
+	invalidate_wavetable_items(0, CYD_WAVE_MAX_ENTRIES);
+	
 	set_channels(mused.song.num_channels);
 }
 
@@ -54,6 +54,8 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "theme.h"
 
 #include "combWFgen.h"
+#include "dspload.h"
+#include "buftune.h"
 
 #ifdef MIDI
 
@@ -209,11 +211,6 @@ void my_open_menu(const Menu *menu, const Menu *action)
 #undef main
 #endif
 
-int TriSaw_8580[4096]; //wasn't there
-int PulseSaw_8580[4096];
-int PulseTriSaw_8580[4096];
-int PulseTri_8580[8192];
-
 int main(int argc, char **argv)
 {
 #ifdef WIN32
@@ -228,11 +225,6 @@ int main(int argc, char **argv)
 	
 	debug("Starting %s", VERSION_STRING);
 	
-	createCombinedWF(PulseSaw_8580,1.4,1.9,0.68); //wasn't there
-	createCombinedWF(PulseTriSaw_8580,0.8,2.5,0.64); 
-	createCombinedWF(TriSaw_8580,0.8,2.4,0.64); 
-	createPulseTri(PulseTri_8580,1.4,1.9,0.68); //createPulseTri(PulseTri_8580,3.1,1.1,0.64);
-
 	SDL_Init(SDL_INIT_VIDEO|SDL_INIT_AUDIO|SDL_INIT_NOPARACHUTE|SDL_INIT_TIMER);
 	atexit(SDL_Quit);
 
@@ -268,7 +260,12 @@ int main(int argc, char **argv)
 	for (int i = 0 ; i < CYD_MAX_FX_CHANNELS ; ++i)
 		cydfx_set(&mused.cyd.fx[i], &mused.song.fx[i]);
 
-	cyd_register(&mused.cyd, mused.mix_buffer);
+	dl_register(&mused.cyd, bt_init());
+	dl_set_tap(&mused.output_ring);
+	dl_set_command_queue(&mused.cmdq, run_audio_command);
+#ifdef MIDI
+	dl_set_timed_queue(&mused.midiq, run_audio_command);
+#endif
 
 	if (argc > 1)
 	{
@@ -434,17 +431,17 @@ int main(int argc, char **argv)
 
 					// key events should go only to the edited text field
 
+					// No lock here, jamming goes through mused.cmdq and edits that
+					// move or free data the player reads build the new data first
+					// and lock only to swap it in (see swap_pattern_steps())
+
 					if (mused.focus != EDITBUFFER)
 					{
-						cyd_lock(&mused.cyd, 1);
 						do_shortcuts(&e.key, shortcuts);
-						cyd_lock(&mused.cyd, 0);
 					}
 
 					if (e.key.keysym.sym != 0)
 					{
-						cyd_lock(&mused.cyd, 1);
-
 						switch (mused.focus)
 						{
 							case EDITBUFFER:
@@ -479,8 +476,6 @@ int main(int argc, char **argv)
 							songinfo_event(&e);
 							break;
 						}
-
-						cyd_lock(&mused.cyd, 0);
 					}
 				}
 				break;
@@ -509,6 +504,8 @@ int main(int argc, char **argv)
 				break;
 		}
 
+		bt_update();
+
 		int prev_position = mused.stat_song_position;
 
 		if (active) mus_poll_status(&mused.mus, &mused.stat_song_position, mused.stat_pattern_position, mused.stat_pattern, channel, mused.vis.cyd_env, mused.stat_note, &mused.time_played);
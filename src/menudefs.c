@@ -33,6 +33,7 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "stats.h"
 #include "zap.h"
 #include "optimize.h"
+#include "profiler.h"
 
 extern Mused mused;
 
@@ -59,6 +60,7 @@ Menu analyzermenu[] =
 {
 	{ 0, showmenu, "Spectrum",  NULL, change_visualizer_action, (void*)VIS_SPECTRUM, 0, 0 },
 	{ 0, showmenu, "CATOMETER!",  NULL, change_visualizer_action, (void*)VIS_CATOMETER, 0, 0 },
+	{ 0, showmenu, "Oscilloscope",  NULL, change_visualizer_action, (void*)VIS_OSCILLOSCOPE, 0, 0 },
 	{ 0, NULL, NULL }
 };
 
@@ -83,6 +85,7 @@ static const Menu showmenu[] =
 	{ 0, mainmenu, "Show analyzer", NULL, MENU_CHECK, &mused.flags, (void*)SHOW_ANALYZER, 0 },
 	{ 0, mainmenu, "Analyzer", analyzermenu, NULL },
 	{ 0, mainmenu, "Show logo", NULL, MENU_CHECK, &mused.flags, (void*)SHOW_LOGO, 0 },
+	{ 0, mainmenu, "Show DSP load", NULL, MENU_CHECK, &mused.flags, (void*)SHOW_DSP_LOAD, 0 },
 	{ 0, NULL, NULL }
 };
 
@@ -130,6 +133,7 @@ const Menu prefsmenu[] =
 	{ 0, mainmenu, "Fullscreen", NULL, MENU_CHECK_NOSET, &mused.flags, (void*)FULLSCREEN, toggle_fullscreen },
 	{ 0, mainmenu, "Disable rendering to texture", NULL, MENU_CHECK_NOSET, &mused.flags, (void*)DISABLE_RENDER_TO_TEXTURE, toggle_render_to_texture },
 	{ 0, mainmenu, "Oversampling", oversamplemenu },
+	{ 0, mainmenu, "Automatic mix buffer", NULL, MENU_CHECK, &mused.auto_mix_buffer, (void*)1, 0 },
 	{ 0, mainmenu, "", NULL, NULL },
 #ifdef MIDI
 	{ 0, mainmenu, "MIDI", midi_menu },
@@ -195,6 +199,7 @@ const Menu filemenu[] =
 	{ 0, mainmenu, "Open recent", recentmenu },
 	{ 0, mainmenu, "Export .WAV", NULL, export_wav_action },
 	{ 0, mainmenu, "Export tracks as .WAV", NULL, export_channels_action },
+	{ 0, mainmenu, "Export DSP load stats", NULL, export_dsp_load_action },
 	{ 0, mainmenu, "Import", importmenu },
 	{ 0, mainmenu, "", NULL, NULL },
 	{ 0, mainmenu, "Instrument", instmenu },
@@ -221,7 +226,8 @@ static const Menu infomenu[] =
 {
 	{ 0, mainmenu, "About",  NULL, show_about_box, (void*)0, 0, 0 },
 	{ 0, mainmenu, "Song statistics",  NULL, song_stats, (void*)0, 0, 0 },
-	{ 0, mainmenu, "Help",  NULL, open_help_no_lock, (void*)0, 0, 0 },
+	{ 0, mainmenu, "CPU profile",  NULL, profile_song_action, (void*)0, 0, 0 },
+	{ 0, mainmenu, "Help",  NULL, open_help, (void*)0, 0, 0 },
 	{ 0, NULL, NULL }
 };
 
@@ -256,9 +262,11 @@ static const Menu zapmenu[] =
 static const Menu optimizemenu[] =
 {
 	{ 0, editmenu, "Kill duplicate patterns",  NULL, optimize_patterns_action, 0, 0, 0 },
+	{ 0, editmenu, "Fold transposed patterns",  NULL, optimize_transposed_patterns_action, 0, 0, 0 },
 	{ 0, editmenu, "Kill unused instruments",  NULL, optimize_instruments_action, 0, 0, 0 },
 	{ 0, editmenu, "Kill unused wavetables",  NULL, optimize_wavetables_action, 0, 0, 0 },
 	{ 0, editmenu, "Kill duplicate wavetables",  NULL, duplicate_wavetables_action, 0, 0, 0 }, //wasn't there
+	{ 0, editmenu, "Kill near-duplicate wavetables",  NULL, duplicate_wavetables_action, MAKEPTR(WAVE_DEDUP_TRAILING_SILENCE), 0, 0 },
 	{ 0, NULL, NULL }
 };
 
@@ -4,6 +4,7 @@
 
 #include "mused.h"
 #include "mymsg.h"
+#include <math.h>
 
 #define MAX_MIDI_DEVICES 32
 
@@ -35,6 +36,9 @@ Menu midi_channel_menu[] =
 Menu midi_menu[] =
 {
 	{ 0, prefsmenu, "MIDI sync", NULL, MENU_CHECK, &mused.flags, (void*)MIDI_SYNC, 0 },
+#ifdef __linux__
+	{ 0, prefsmenu, "Send MIDI clock", NULL, MENU_CHECK, &mused.midi_clock_out, (void*)1, 0 },
+#endif
 	{ 0, prefsmenu, "Device", midi_device_menu, NULL, 0, 0, 0 },
 	{ 0, prefsmenu, "Channel", midi_channel_menu, NULL, 0, 0, 0 },
 	{ 0, NULL, NULL }
@@ -43,37 +47,92 @@ Menu midi_menu[] =
 static char midi_device_names[MAX_MIDI_DEVICES][100];
 
 
-static void midi_clock(Uint32 ms)
+/*
+Clock recovery for MIDI sync. The arrival times of the clock messages go
+through a second order delay-locked loop (F. Adriaensen, "Using a DLL to
+filter time") which gives a smoothed clock period. One engine tick lasts
+one clock, the audio thread sets the tick length from the period in
+fractional samples so the tempo follows without restarting the callback.
+*/
+
+#define CLOCK_BANDWIDTH 0.5 // Hz, lower is smoother but follows tempo changes slower
+#define CLOCK_TIMEOUT 0.5 // seconds without a clock restarts the loop
+
+static struct
 {
-	if (mused.tick_ctr == 0 && mused.midi_start)
+	int count;
+	double prev; // arrival of the previous clock
+	double next; // predicted arrival of the next clock
+	double period;
+	double b, c; // loop coefficients
+} dll;
+
+static SDL_atomic_t tick_length; // 16.16 samples, 0 = unknown
+static double tick_phase; // audio thread only
+
+
+static void midi_clock_in(Uint64 counter)
+{
+	const double t = (double)counter / SDL_GetPerformanceFrequency();
+	
+	if (dll.count == 0 || t - dll.prev > CLOCK_TIMEOUT)
 	{
-		mused.midi_last_clock = ms;
+		dll.count = 1;
 	}
-	else if (mused.tick_ctr == 12)
+	else if (dll.count == 1)
 	{
-		mused.tick_ctr = 0;
+		dll.period = t - dll.prev;
+		dll.next = t + dll.period;
 		
-		if (ms - mused.midi_last_clock)
-			mused.midi_rate = 1000 / ((ms - mused.midi_last_clock) / 12);
-		mused.midi_last_clock = ms;
-
-		if (mused.midi_rate)
-		{
-			enable_callback(true);
-			mused.song.song_rate = mused.midi_rate;
-		}
+		const double omega = 2 * M_PI * CLOCK_BANDWIDTH * dll.period;
+		dll.b = sqrt(2) * omega;
+		dll.c = omega * omega;
+		dll.count = 2;
 	}
+	else
+	{
+		const double e = t - dll.next;
+		dll.next += dll.b * e + dll.period;
+		dll.period += dll.c * e;
+	}
+	
+	dll.prev = t;
+	
+	if (dll.count == 2)
+		SDL_AtomicSet(&tick_length, dll.period * mused.cyd.sample_rate * 65536);
+	
+	// The tick itself is run by the audio thread at the offset the clock arrived at
+	
+	AudioCmd cmd = { CQ_EXT_SYNC, -1, 0, 0, counter };
+	
+	if (!cq_push(&mused.midiq, &cmd))
+		debug("MIDI clock queue full");
+}
+
 
+void midi_sync_tick(CydEngine *cyd)
+{
+	const int length = SDL_AtomicGet(&tick_length);
+	
+	if (length == 0)
+		return;
+	
+	// Carry the fraction over so the average tick length is exact
+	
+	tick_phase += length / 65536.0;
+	cyd->callback_period = my_max(1, (int)tick_phase);
+	tick_phase -= (int)tick_phase;
+}
+
+
+static void midi_clock()
+{
 	if (mused.midi_start)
 	{
 		mused.flags |= SONG_PLAYING;
 	}
 	
-	if (mused.mus.flags & MUS_EXT_SYNC)
-		mus_ext_sync(&mused.mus);
-
 	mused.midi_start = false;
-	++mused.tick_ctr;
 }
 
 
@@ -81,16 +140,10 @@ static void midi_start()
 {
 	debug("MIDI start");
 	mused.midi_start = true;
-	mused.tick_ctr = 0;
 	mus_set_song(&mused.mus, &mused.song, 0);
 	mused.mus.flags |= MUS_EXT_SYNC;
 	mused.mus.ext_sync_ticks = 0;
-	
-	if (mused.midi_rate)
-	{
-		enable_callback(true);
-		mused.song.song_rate = mused.midi_rate;
-	}
+	enable_callback(true);
 }
 
 
@@ -126,7 +179,7 @@ void midi_event(SDL_Event *e)
 	switch (e->type)
 	{
 		case MSG_CLOCK:
-			midi_clock(e->user.code);
+			midi_clock();
 			break;
 
 		case MSG_START:
@@ -148,6 +201,30 @@ void midi_event(SDL_Event *e)
 }
 
 
+/*
+Called on the MIDI thread. The note is played by the audio thread at the
+offset it arrived at, the UI only records it. If the queue is full the UI
+plays it the old way.
+*/
+
+static void midi_note(bool on, Uint8 note, Uint8 velocity)
+{
+	AudioCmd cmd = { on ? CQ_NOTE_ON : CQ_NOTE_OFF, -1, note, mused.current_instrument, SDL_GetPerformanceCounter() };
+	const bool queued = cq_push(&mused.midiq, &cmd);
+	
+	if (!queued)
+		debug("MIDI note queue full");
+	
+	SDL_Event e;
+	SDL_zero(e);
+	e.type = on ? MSG_NOTEON : MSG_NOTEOFF;
+	e.user.code = note;
+	e.user.data1 = MAKEPTR(velocity);
+	e.user.data2 = MAKEPTR(queued);
+	SDL_PushEvent(&e);
+}
+
+
 #ifdef WIN32
 
 #include <windows.h>
@@ -176,24 +253,12 @@ static void CALLBACK MidiInProc(HMIDIIN hMidiIn, UINT wMsg, DWORD_PTR dwInstance
 				switch (command)
 				{
 					case 0x90:
-					{
-						SDL_Event e;
-						e.type = MSG_NOTEON;
-						e.user.code = (dwParam1 >> 8) & 0xff;
-						e.user.data1 = MAKEPTR((dwParam1 >> 16) & 0xff);
-						SDL_PushEvent(&e);
-					}
-					break;
+						midi_note(true, (dwParam1 >> 8) & 0xff, (dwParam1 >> 16) & 0xff);
+						break;
 						
 					case 0x80:
-					{
-						SDL_Event e;
-						e.type = MSG_NOTEOFF;
-						e.user.code = (dwParam1 >> 8) & 0xff;
-						e.user.data1 = MAKEPTR((dwParam1 >> 16) & 0xff);
-						SDL_PushEvent(&e);
-					}
-					break;
+						midi_note(false, (dwParam1 >> 8) & 0xff, (dwParam1 >> 16) & 0xff);
+						break;
 					
 					case 0xC0:
 					{
@@ -213,7 +278,8 @@ static void CALLBACK MidiInProc(HMIDIIN hMidiIn, UINT wMsg, DWORD_PTR dwInstance
 				switch ((dwParam1 & 0xFF))
 				{
 					case 0xF8:
-						midi_clock(dwParam2);
+						midi_clock_in(SDL_GetPerformanceCounter());
+						midi_clock();
 						break;
 				
 					case 0xFA:
@@ -319,6 +385,9 @@ void midi_init()
 }
 
 
+void midi_clock_out_tick(CydEngine *cyd) {}
+
+
 void midi_deinit() 
 {
 	if (hMidiIn)
@@ -332,9 +401,13 @@ void midi_deinit()
 #elif defined(__linux__)
 
 #include <alsa/asoundlib.h>
+#include "dspload.h"
 
 static snd_seq_t *seq_handle = NULL;
 static int in_port = -1;
+static int out_port = -1;
+static int out_queue = -1;
+static Uint64 out_origin; // performance counter when out_queue was started
 static int src_client = -1;
 static int src_port = -1;
 
@@ -360,14 +433,8 @@ static int midi_thread(void *data)
 			{
 				case SND_SEQ_EVENT_NOTEON:
 				case SND_SEQ_EVENT_NOTEOFF:
-				{
-					SDL_Event e;
-					e.type = ev->type == SND_SEQ_EVENT_NOTEON ? MSG_NOTEON : MSG_NOTEOFF;
-					e.user.code = ev->data.note.note;
-					e.user.data1 = MAKEPTR(ev->data.note.velocity);
-					SDL_PushEvent(&e);
+					midi_note(ev->type == SND_SEQ_EVENT_NOTEON, ev->data.note.note, ev->data.note.velocity);
 					break;
-				}
 
 				case SND_SEQ_EVENT_PGMCHANGE:
 				{
@@ -385,9 +452,10 @@ static int midi_thread(void *data)
 			{
 				case SND_SEQ_EVENT_CLOCK:
 				{
+					midi_clock_in(SDL_GetPerformanceCounter());
+					
 					SDL_Event e;
-					e.type = MSG_START;
-					e.user.code = ev->time.tick;
+					e.type = MSG_CLOCK;
 					SDL_PushEvent(&e);
 					break;
 				}
@@ -430,6 +498,196 @@ static int midi_thread(void *data)
 	return 0;
 }
 
+/*
+MIDI clock output. The audio thread walks the engine's tick timeline and
+queues the messages with the time they will be heard, the output thread
+schedules them on an ALSA queue so that neither the audio thread nor the
+UI loop affect when they are sent.
+*/
+
+#define CLOCK_OUT_DRIFT 0.001 // how fast the tick timeline follows the audio clock
+
+enum
+{
+	OUT_CLOCK,
+	OUT_START,
+	OUT_CONTINUE,
+	OUT_STOP,
+	OUT_SPP
+};
+
+static CmdQueue out_cmds;
+static SDL_sem *out_ready; // posted for every queued message
+static SDL_Thread *out_thread;
+static SDL_atomic_t out_quit;
+
+static struct
+{
+	bool playing;
+	double time; // when the current tick is heard
+	double phase; // fraction of a clock at the current tick
+} out; // audio thread only
+
+
+static void queue_out(int type, int value, double time)
+{
+	AudioCmd cmd = { type, -1, value, 0, time * SDL_GetPerformanceFrequency() };
+	
+	if (cq_push(&out_cmds, &cmd))
+		SDL_SemPost(out_ready);
+	else
+		debug("MIDI clock output queue full");
+}
+
+
+void midi_clock_out_tick(CydEngine *cyd)
+{
+	const bool playing = mused.midi_clock_out && out_port >= 0 && mused.mus.song != NULL;
+	const int rows_per_beat = (mused.time_signature & 0xff) ? (mused.time_signature & 0xff) : 4;
+	
+	if (playing != out.playing)
+	{
+		out.playing = playing;
+		out.time = dl_render_time();
+		
+		if (playing)
+		{
+			// Song position pointer counts sixteenth notes
+			
+			const int position = mused.mus.song_position * 4 / rows_per_beat;
+			
+			out.phase = 0;
+			
+			if (position == 0)
+			{
+				queue_out(OUT_START, 0, out.time);
+			}
+			else
+			{
+				queue_out(OUT_SPP, position, out.time);
+				queue_out(OUT_CONTINUE, 0, out.time);
+			}
+		}
+		else
+		{
+			queue_out(OUT_STOP, 0, out.time);
+			return;
+		}
+	}
+	
+	if (!playing)
+		return;
+	
+	// 24 clocks per beat, shuffle is averaged out
+	
+	const double clocks_per_tick = 24.0 / (rows_per_beat * (mused.song.song_speed + mused.song.song_speed2) / 2.0);
+	const double length = (double)cyd->callback_period / cyd->sample_rate;
+	
+	for (double c = ceil(out.phase) ; c < out.phase + clocks_per_tick ; c += 1)
+		queue_out(OUT_CLOCK, 0, out.time + (c - out.phase) / clocks_per_tick * length);
+	
+	out.phase += clocks_per_tick;
+	out.phase -= floor(out.phase);
+	
+	// Tick lengths are exact in samples, only the slow drift between the
+	// sound card and the performance counter needs correcting
+	
+	out.time += length;
+	out.time += (dl_render_time() - out.time) * CLOCK_OUT_DRIFT;
+}
+
+
+static int midi_out_thread(void *data)
+{
+	const double freq = SDL_GetPerformanceFrequency();
+	const int port = out_port; // midi_deinit() clears out_port before the last flush
+	
+	for (;;)
+	{
+		AudioCmd cmd;
+		bool sent = false;
+		
+		SDL_SemWait(out_ready);
+		
+		while (cq_pop(&out_cmds, &cmd))
+		{
+			static const int types[] = { SND_SEQ_EVENT_CLOCK, SND_SEQ_EVENT_START, SND_SEQ_EVENT_CONTINUE, SND_SEQ_EVENT_STOP, SND_SEQ_EVENT_SONGPOS };
+			const double t = cmd.time > out_origin ? (cmd.time - out_origin) / freq : 0;
+			snd_seq_real_time_t time = { t, (t - (int)t) * 1000000000 };
+			snd_seq_event_t ev;
+			
+			snd_seq_ev_clear(&ev);
+			snd_seq_ev_set_source(&ev, port);
+			snd_seq_ev_set_subs(&ev);
+			snd_seq_ev_schedule_real(&ev, out_queue, 0, &time);
+			ev.type = types[cmd.type];
+			ev.data.control.value = cmd.note;
+			
+			chk(snd_seq_event_output(seq_handle, &ev), "snd_seq_event_output");
+			sent = true;
+		}
+		
+		if (sent)
+			snd_seq_drain_output(seq_handle);
+		
+		// Quitting posts once more so anything queued before is sent first
+		
+		if (SDL_AtomicGet(&out_quit))
+			break;
+	}
+	
+	return 0;
+}
+
+
+static void midi_clock_out_init()
+{
+	out_port = chk(snd_seq_create_simple_port(seq_handle, "clock out",
+					 SND_SEQ_PORT_CAP_READ |
+					 SND_SEQ_PORT_CAP_SUBS_READ,
+					 SND_SEQ_PORT_TYPE_MIDI_GENERIC |
+					 SND_SEQ_PORT_TYPE_APPLICATION), "snd_seq_create_simple_port");
+	
+	if (out_port < 0)
+		return;
+	
+	out_queue = chk(snd_seq_alloc_named_queue(seq_handle, "klystrack clock"), "snd_seq_alloc_named_queue");
+	
+	if (out_queue < 0 || chk(snd_seq_start_queue(seq_handle, out_queue, NULL), "snd_seq_start_queue") < 0)
+		goto fail;
+	
+	snd_seq_drain_output(seq_handle);
+	out_origin = SDL_GetPerformanceCounter();
+	
+	cq_init(&out_cmds);
+	SDL_AtomicSet(&out_quit, 0);
+	
+	out_ready = SDL_CreateSemaphore(0);
+	
+	if (out_ready == NULL)
+	{
+		warning("SDL_CreateSemaphore failed: %s", SDL_GetError());
+		goto fail;
+	}
+	
+	out_thread = SDL_CreateThread(midi_out_thread, "ALSA MIDI out", NULL);
+	
+	if (out_thread == NULL)
+	{
+		warning("SDL_CreateThread failed: %s", SDL_GetError());
+		SDL_DestroySemaphore(out_ready);
+		out_ready = NULL;
+		goto fail;
+	}
+	
+	return;
+	
+fail:
+	snd_seq_delete_simple_port(seq_handle, out_port);
+	out_port = -1;
+}
+
+
 void midi_set_device(void *dev, void *client, void *port)
 {
 	mused.midi_device = my_min(CASTPTR(int, dev), MAX_MIDI_DEVICES - 1);
@@ -476,7 +734,7 @@ void midi_init(Uint32 uDeviceID)
 
 	midi_set_channel(MAKEPTR(mused.midi_channel), 0, 0);
 
-	int err = snd_seq_open(&seq_handle, "default", SND_SEQ_OPEN_INPUT, 0);
+	int err = snd_seq_open(&seq_handle, "default", SND_SEQ_OPEN_DUPLEX, 0);
 	if (chk(err, "snd_seq_open") < 0)
 		return;
 
@@ -492,6 +750,8 @@ void midi_init(Uint32 uDeviceID)
 	if (in_port < 0)
 		return;
 
+	midi_clock_out_init();
+
 	SDL_Thread *thread = SDL_CreateThread(midi_thread, "ALSA MIDI", NULL);
 	if (thread == NULL)
 	{
@@ -547,6 +807,37 @@ done:
 
 void midi_deinit()
 {
+	if (out_thread != NULL)
+	{
+		// Keep the audio thread out while we act as the producer, stop the
+		// receivers if the clock is still running and let the thread flush
+		
+		SDL_LockAudio();
+		
+		if (out.playing)
+		{
+			// After the clocks already queued for the current tick
+			queue_out(OUT_STOP, 0, out.time);
+			out.playing = false;
+		}
+		
+		out_port = -1;
+		
+		SDL_UnlockAudio();
+		
+		SDL_AtomicSet(&out_quit, 1);
+		SDL_SemPost(out_ready);
+		SDL_WaitThread(out_thread, NULL);
+		out_thread = NULL;
+		
+		SDL_DestroySemaphore(out_ready);
+		out_ready = NULL;
+		
+		// Scheduled messages are lost if the client closes before they go out
+		
+		snd_seq_sync_output_queue(seq_handle);
+	}
+
 	if (seq_handle != NULL)
 	{
 		chk(snd_seq_close(seq_handle), "snd_seq_close");
@@ -559,6 +850,7 @@ void midi_deinit()
 void midi_set_channel(void *chn, void *unused1, void *unused2) {}
 void midi_init(Uint32 uDeviceID) {}
 void midi_deinit() {}
+void midi_clock_out_tick(CydEngine *cyd) {}
 
 #endif
 #endif // MIDI
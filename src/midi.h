@@ -31,6 +31,7 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "SDL.h"
 
 #include "gui/menu.h"
+#include "snd/cyd.h"
 
 extern Menu midi_menu[];
 
@@ -38,6 +39,10 @@ void midi_event(SDL_Event *e);
 void midi_init();
 void midi_deinit();
 void midi_set_channel(void *chn, void *unused1, void *unused2);
+/* Audio thread, sets the length of the next tick when following MIDI clock */
+void midi_sync_tick(CydEngine *cyd);
+/* Audio thread, sends MIDI clock for the tick when clock output is enabled */
+void midi_clock_out_tick(CydEngine *cyd);
 
 #endif
 
@@ -36,6 +36,8 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "view/wavetableview.h"
 #include "zap.h"
 #include "diskop.h"
+#include "usage.h"
+#include "midi.h"
 #include <stdarg.h>
 #include <string.h>
 
@@ -126,6 +128,19 @@ void change_mode(int newmode)
 }
 
 
+static void clear_steps(MusStep *step, int first, int last)
+{
+	for (int i = first ; i < last ; ++i)
+	{
+		step[i].note = MUS_NOTE_NONE;
+		step[i].instrument = MUS_NOTE_NO_INSTRUMENT;
+		step[i].ctrl = 0;
+		step[i].command = 0;
+		step[i].volume = MUS_NOTE_NO_VOLUME;
+	}
+}
+
+
 void clear_pattern(MusPattern *pat)
 {
 	snapshot(S_T_PATTERN);
@@ -135,14 +150,59 @@ void clear_pattern(MusPattern *pat)
 
 void clear_pattern_range(MusPattern *pat, int first, int last)
 {
-	for (int i = my_max(0, first) ; i < my_min(pat->num_steps, last) ; ++i)
+	MusStep *steps = copy_pattern_steps(pat, pat->num_steps);
+
+	if (!steps)
 	{
-		pat->step[i].note = MUS_NOTE_NONE;
-		pat->step[i].instrument = MUS_NOTE_NO_INSTRUMENT;
-		pat->step[i].ctrl = 0;
-		pat->step[i].command = 0;
-		pat->step[i].volume = MUS_NOTE_NO_VOLUME;
+		set_info_message("Out of memory!");
+		return;
 	}
+
+	clear_steps(steps, my_max(0, first), my_min(pat->num_steps, last));
+	swap_pattern_steps(pat, steps, pat->num_steps);
+}
+
+
+MusStep * copy_pattern_steps(const MusPattern *pattern, int num_steps)
+{
+	MusStep *steps = malloc(sizeof(steps[0]) * (size_t)my_max(1, num_steps));
+
+	if (!steps)
+		return NULL;
+
+	const int copied = pattern ? my_max(0, my_min(num_steps, pattern->num_steps)) : 0;
+
+	if (copied > 0)
+		memcpy(steps, pattern->step, sizeof(steps[0]) * (size_t)copied);
+
+	clear_steps(steps, copied, num_steps);
+
+	return steps;
+}
+
+
+static void clamp_selection(const MusPattern *pattern)
+{
+	if (mused.focus == EDITPATTERN)
+	{
+		mused.selection.start = my_min(mused.selection.start, pattern->num_steps - 1);
+		mused.selection.end = my_min(mused.selection.end, pattern->num_steps - 1);
+	}
+}
+
+
+void swap_pattern_steps(MusPattern *pattern, MusStep *steps, int num_steps)
+{
+	MusStep *old = pattern->step;
+
+	cyd_lock(&mused.cyd, 1);
+	pattern->step = steps;
+	pattern->num_steps = num_steps;
+	cyd_lock(&mused.cyd, 0);
+
+	free(old);
+
+	clamp_selection(pattern);
 }
 
 
@@ -178,6 +238,8 @@ void new_song()
 
 	mused.modified = false;
 
+	usage_invalidate();
+
 	set_channels(mused.song.num_channels);
 }
 
@@ -188,27 +250,33 @@ void kt_default_instrument(MusInstrument *inst)
 }
 
 
-void resize_pattern(MusPattern * pattern, Uint16 new_size)
+bool resize_pattern(MusPattern * pattern, Uint16 new_size)
 {
 	int old_steps = pattern->num_steps;
 
 	if (new_size == old_steps)
-		return;
-
-	pattern->num_steps = new_size;
+		return true;
 
 	if (new_size > old_steps)
 	{
-		pattern->step = realloc(pattern->step, sizeof(pattern->step[0]) * (size_t)new_size);
-		clear_pattern_range(pattern, old_steps, new_size);
-	}
+		MusStep *steps = copy_pattern_steps(pattern, new_size);
 
+		if (!steps)
+		{
+			set_info_message("Out of memory!");
+			return false;
+		}
 
-	if (mused.focus == EDITPATTERN)
+		swap_pattern_steps(pattern, steps, new_size);
+	}
+	else
 	{
-		mused.selection.start = my_min(mused.selection.start, pattern->num_steps - 1);
-		mused.selection.end = my_min(mused.selection.end, pattern->num_steps - 1);
+		// The player never reads past num_steps and the buffer stays as it is
+		pattern->num_steps = new_size;
+		clamp_selection(pattern);
 	}
+
+	return true;
 }
 
 
@@ -256,6 +324,8 @@ void init(MusInstrument *instrument, MusPattern *pattern, MusSeqPattern sequence
 	mused.edit_backup_buffer = NULL;
 	mused.mix_rate = 44100;
 	mused.mix_buffer = 2048;
+	mused.auto_mix_buffer = 1;
+	strcpy(mused.tuned_mix_buffers, "");
 	mused.fx_room_size = 16;
 	mused.fx_room_vol = 16;
 	mused.fx_room_dec = 5;
@@ -277,10 +347,11 @@ void init(MusInstrument *instrument, MusPattern *pattern, MusSeqPattern sequence
 
 	for (int i = 0 ; i < NUM_PATTERNS ; ++i)
 	{
-		mused.song.pattern[i].step = NULL;
-		mused.song.pattern[i].num_steps = 0;
+		// The engine isn't up yet so resize_pattern() can't lock it
+
+		mused.song.pattern[i].step = copy_pattern_steps(NULL, mused.default_pattern_length);
+		mused.song.pattern[i].num_steps = mused.song.pattern[i].step ? mused.default_pattern_length : 0;
 		mused.song.pattern[i].color = 0;
-		resize_pattern(&mused.song.pattern[i], mused.default_pattern_length);
 	}
 
 	undo_init(&mused.undo);
@@ -309,6 +380,28 @@ void init(MusInstrument *instrument, MusPattern *pattern, MusSeqPattern sequence
 
 	mused.wgset.num_oscs = 1;
 	mused.wgset.length = 256;
+	mused.wgset.band_limit = false;
+	mused.wgset.top_note = MIDDLE_C + 36;
+	mused.wgset.mips = 1;
+
+	mused.wfset.type = WF_LOWPASS;
+	mused.wfset.cutoff = 2000;
+	mused.wfset.q = 71;
+	mused.wfset.gain = 6;
+	mused.wfset.taps = 127;
+
+	mused.wrset.rate = 22050;
+	mused.wrset.transpose = 0;
+	mused.wrset.taps = 32;
+
+	mused.wbset.last = 0;
+	mused.wbset.ops = WB_REMOVE_DC | WB_NORMALIZE;
+
+	cq_init(&mused.cmdq);
+#ifdef MIDI
+	cq_init(&mused.midiq);
+#endif
+	ar_init(&mused.output_ring);
 
 	mused.prev_wavetable_x = -1;
 	mused.prev_wavetable_y = -1;
@@ -364,6 +457,9 @@ void deinit()
 
 	if (mused.wavetable_preview)
 		gfx_free_surface(mused.wavetable_preview);
+
+	free_wavegen_previews();
+	free_wavetable_peaks();
 }
 
 
@@ -411,6 +507,18 @@ void post_config_load()
 
 static int tick_cb(void *data)
 {
+	AudioCmd cmd;
+
+	while (cq_pop(&mused.cmdq, &cmd))
+		run_audio_command(&cmd);
+
+#ifdef MIDI
+	if (mused.mus.flags & MUS_EXT_SYNC)
+		midi_sync_tick(&mused.cyd);
+	else
+		midi_clock_out_tick(&mused.cyd);
+#endif
+
 	return mus_advance_tick(data);
 }
 
@@ -546,8 +654,10 @@ void set_info_message(const char *message, ...)
 void set_channels(int channels)
 {
 	debug("Changed num_channels = %d", channels);
+	cyd_lock(&mused.cyd, 1);
 	mused.song.num_channels = channels;
 	cyd_reserve_channels(&mused.cyd, channels);
+	cyd_lock(&mused.cyd, 0);
 }
 
 
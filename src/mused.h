@@ -57,6 +57,11 @@ enum
 #include "undo.h"
 #include <stdbool.h>
 #include "wavegen.h"
+#include "wavefilter.h"
+#include "waveresample.h"
+#include "wavebatch.h"
+#include "cmdqueue.h"
+#include "audioring.h"
 #include "diskop.h"
 
 #define SCREEN_WIDTH 320
@@ -75,6 +80,7 @@ enum
 	HIDE_ZEROS = 128,
 	DELETE_EMPTIES = 256,
 	EDIT_MODE = 512,
+	SHOW_DSP_LOAD = 1024,
 	SHOW_ANALYZER = 2048,
 #ifdef MIDI
 	MIDI_SYNC = 4096,
@@ -111,6 +117,7 @@ enum
 {
 	VIS_SPECTRUM = 0,
 	VIS_CATOMETER = 1,
+	VIS_OSCILLOSCOPE = 2,
 	VIS_NUM_TOTAL
 };
 
@@ -162,6 +169,8 @@ typedef struct
 	char themename[100], keymapname[100];
 	int pixel_scale;
 	int mix_rate, mix_buffer;
+	int auto_mix_buffer;
+	char tuned_mix_buffers[100]; // see buftune.c
 	int window_w, window_h;
 	int fx_bus, fx_room_size, fx_room_vol, fx_room_dec, fx_tap, fx_axis, fx_room_ticks, fx_room_prev_x, fx_room_prev_y;
 	/*---vis---*/
@@ -185,19 +194,26 @@ typedef struct
 	GfxSurface *wavetable_preview;
 	Uint16 wavetable_bits;
 	int prev_wavetable_x, prev_wavetable_y;
+	int wavetable_view_start, wavetable_view_length; // zoomed part of the sample, length 0 shows everything
 	
 #ifdef MIDI
 	Uint32 midi_device;
 	Uint8 midi_channel;
 	bool midi_start;
-	Uint16 midi_rate;
-	Uint32 midi_last_clock;
-	Uint8 tick_ctr;
+	int midi_clock_out;
+	CmdQueue midiq; // timestamped notes and clocks from the MIDI thread
 #endif
 
 	WgSettings wgset;
 	int selected_wg_osc, selected_wg_preset;
 	
+	WfSettings wfset;
+	WrSettings wrset;
+	WbSettings wbset;
+	
+	CmdQueue cmdq;
+	AudioRing output_ring;
+	
 	int oversample;
 } Mused;
 
@@ -220,7 +236,17 @@ void kt_default_instrument(MusInstrument *instrument);
 void set_edit_buffer(char *buffer, size_t size);
 void change_pixel_scale(void *a, void*b, void*c);
 void mirror_flags();
-void resize_pattern(MusPattern * pattern, Uint16 new_size);
+/* Returns false if out of memory, the pattern is left as it was */
+bool resize_pattern(MusPattern * pattern, Uint16 new_size);
+/*
+The player reads the steps while they are edited so bulk edits are made on a
+copy and swapped in under the engine lock, single fields are written in place.
+copy_pattern_steps() returns the first num_steps steps of pattern (NULL for
+an empty one) with the rest cleared, or NULL if out of memory.
+swap_pattern_steps() takes ownership of steps and frees the old ones.
+*/
+MusStep * copy_pattern_steps(const MusPattern *pattern, int num_steps);
+void swap_pattern_steps(MusPattern *pattern, MusStep *steps, int num_steps);
 void init_scrollbars();
 void my_open_menu();
 int viscol(int col);
@@ -28,37 +28,14 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "edit.h"
 #include "macros.h"
 #include "mused.h"
+#include "usage.h"
+#include "view/wavetableview.h"
+#include "snd/freqs.h"
 #include <string.h>
 
 bool is_pattern_used(const MusSong *song, int p)
 {
-	for (int c = 0 ; c < song->num_channels ; ++c)
-	{
-		for (int s = 0 ; s < song->num_sequences[c] ; ++s)
-		{
-			if (song->sequence[c][s].pattern == p)
-			{
-				return true;
-			}
-		}
-	}
-
-	return false;
-}
-
-
-static void replace_pattern(MusSong *song, int from, int to)
-{
-	for (int c = 0 ; c < song->num_channels ; ++c)
-	{
-		for (int s = 0 ; s < song->num_sequences[c] ; ++s)
-		{
-			if (song->sequence[c][s].pattern == from)
-			{
-				song->sequence[c][s].pattern = to;
-			}
-		}
-	}
+	return usage_pattern_count(song, p) > 0;
 }
 
 
@@ -95,300 +72,833 @@ bool is_pattern_empty(const MusPattern *a)
 
 bool is_instrument_used(const MusSong *song, int instrument)
 {
+	return usage_instrument_count(song, instrument) > 0;
+}
+
+
+bool is_wavetable_used(const MusSong *song, int wavetable)
+{
+	return usage_wavetable_count(song, wavetable) > 0;
+}
+
+
+/* Rewrites every wavetable reference w with remap[w] if w is within the table */
+
+static void remap_wavetables(MusSong *song, const int *remap)
+{
+	const int nw = song->num_wavetables;
+	
+	for (int i = 0 ; i < song->num_instruments ; ++i)
+	{
+		MusInstrument *inst = &song->instrument[i];
+		
+		if (inst->wavetable_entry < nw)
+			inst->wavetable_entry = remap[inst->wavetable_entry];
+		
+		if (inst->fm_wave < nw)
+			inst->fm_wave = remap[inst->fm_wave];
+		
+		for (int p = 0 ; p < MUS_PROG_LEN ; ++p)
+			if ((inst->program[p] & 0x7f00) == MUS_FX_SET_WAVETABLE_ITEM)
+			{
+				Uint8 param = inst->program[p] & 0xff;
+				
+				if (param < nw)
+					inst->program[p] = (inst->program[p] & 0x8000) | MUS_FX_SET_WAVETABLE_ITEM | remap[param];
+			}
+	}
+	
 	for (int p = 0 ; p < song->num_patterns ; ++p)
 	{
 		for (int i = 0 ; i < song->pattern[p].num_steps ; ++i)
 		{
-			if (song->pattern[p].step[i].instrument == instrument)
-				return true;
+			if ((song->pattern[p].step[i].command & 0xff00) == MUS_FX_SET_WAVETABLE_ITEM)
+			{
+				Uint8 param = song->pattern[p].step[i].command & 0xff;
+				
+				if (param < nw)
+					song->pattern[p].step[i].command = MUS_FX_SET_WAVETABLE_ITEM | remap[param];
+			}
 		}
 	}
 	
-	return false;
+	usage_invalidate();
 }
 
 
-static void remove_instrument(MusSong *song, int instrument)
+/* 
+The compact_* functions move the kept items to the front in their original 
+order, clear the rest at the end of the table and rewrite all references 
+with one pass over the song. Return the number of items kept or -1 if out
+of memory, in which case the song is untouched.
+*/
+
+static int compact_patterns(MusSong *song, const bool *keep)
 {
-	for (int p = 0 ; p < song->num_patterns ; ++p)
+	const int n = song->num_patterns;
+	int *remap = malloc(n * sizeof(*remap));
+	MusPattern *temp = malloc(n * sizeof(*temp));
+	int kept = 0, tail = n;
+	
+	if (!remap || !temp)
 	{
-		for (int i = 0 ; i < song->pattern[p].num_steps ; ++i)
+		free(temp);
+		free(remap);
+		return -1;
+	}
+	
+	for (int p = 0 ; p < n ; ++p)
+	{
+		if (keep[p])
 		{
-			if (song->pattern[p].step[i].instrument != MUS_NOTE_NO_INSTRUMENT && song->pattern[p].step[i].instrument > instrument)
-				song->pattern[p].step[i].instrument--;
+			remap[p] = kept;
+			temp[kept++] = song->pattern[p];
+		}
+		else
+		{
+			// removed patterns keep their step buffers but are cleared
+			
+			remap[p] = p;
+			
+			for (int i = 0 ; i < song->pattern[p].num_steps ; ++i)
+				zero_step(&song->pattern[p].step[i]);
+			
+			song->pattern[p].color = 0;
+			temp[--tail] = song->pattern[p];
 		}
 	}
 	
-	for (int i = instrument ; i < song->num_instruments - 1 ; ++i)
-		memcpy(&song->instrument[i], &song->instrument[i + 1], sizeof(song->instrument[i]));
+	memcpy(song->pattern, temp, n * sizeof(*temp));
+	
+	for (int c = 0 ; c < song->num_channels ; ++c)
+		for (int s = 0 ; s < song->num_sequences[c] ; ++s)
+			if (song->sequence[c][s].pattern < n)
+				song->sequence[c][s].pattern = remap[song->sequence[c][s].pattern];
+	
+	free(temp);
+	free(remap);
 	
-	kt_default_instrument(&song->instrument[song->num_instruments - 1]);
+	usage_invalidate();
+	
+	return kept;
 }
 
 
-bool is_wavetable_used(const MusSong *song, int wavetable)
+static int compact_instruments(MusSong *song, const bool *keep)
 {
-	for (int i = 0 ; i < song->num_instruments ; ++i)
+	const int n = song->num_instruments;
+	int *remap = malloc(n * sizeof(*remap));
+	int kept = 0;
+	
+	if (!remap)
+		return -1;
+	
+	for (int i = 0 ; i < n ; ++i)
 	{
-		if (song->instrument[i].wavetable_entry == wavetable)
-		{
-			debug("Wavetable %x used by instrument %x wave", wavetable, i);
-			return true;
-		}
+		remap[i] = keep[i] ? kept : i;
 		
-		if (song->instrument[i].fm_wave == wavetable)
+		if (keep[i])
 		{
-			debug("Wavetable %x used by instrument %x FM", wavetable, i);
-			return true;
+			if (kept != i)
+				memcpy(&song->instrument[kept], &song->instrument[i], sizeof(song->instrument[i]));
+			
+			++kept;
 		}
-		
-		for (int p = 0 ; p < MUS_PROG_LEN ; ++p)
-			if ((song->instrument[i].program[p] & 0x7fff) == (MUS_FX_SET_WAVETABLE_ITEM | wavetable))
-			{
-				debug("Wavetable %x used by instrument %x program (step %d)", wavetable, i, p);
-				return true;
-			}
 	}
 	
+	for (int i = kept ; i < n ; ++i)
+		kt_default_instrument(&song->instrument[i]);
+	
 	for (int p = 0 ; p < song->num_patterns ; ++p)
 	{
 		for (int i = 0 ; i < song->pattern[p].num_steps ; ++i)
 		{
-			if ((song->pattern[p].step[i].command) == (MUS_FX_SET_WAVETABLE_ITEM | wavetable))
-			{
-				debug("Wavetable %x used by pattern %x command (step %d)", wavetable, p, i);
-				return true;
-			}
+			if (song->pattern[p].step[i].instrument < n)
+				song->pattern[p].step[i].instrument = remap[song->pattern[p].step[i].instrument];
 		}
 	}
 	
-	return false;
+	free(remap);
+	
+	usage_invalidate();
+	
+	return kept;
 }
 
 
-static void remove_wavetable(MusSong *song, CydEngine *cyd, int wavetable)
+static int compact_wavetables(MusSong *song, CydEngine *cyd, const bool *keep)
 {
-	debug("Removing wavetable item %d", wavetable);
+	const int n = song->num_wavetables;
+	int *remap = malloc(n * sizeof(*remap));
+	CydWavetableEntry *temp = malloc(n * sizeof(*temp));
+	char **names = malloc(n * sizeof(*names));
+	int kept = 0, tail = n;
 	
-	for (int i = 0 ; i < song->num_instruments ; ++i)
+	if (!remap || !temp || !names)
 	{
-		if (song->instrument[i].wavetable_entry > wavetable)
-			song->instrument[i].wavetable_entry--;
+		free(names);
+		free(temp);
+		free(remap);
+		return -1;
+	}
+	
+	for (int i = 0 ; i < n ; ++i)
+	{
+		if (keep[i])
+		{
+			remap[i] = kept;
+			names[kept] = song->wavetable_names[i];
+			temp[kept++] = cyd->wavetable_entries[i];
+		}
+		else
+		{
+			remap[i] = i;
+			--tail;
+			
+			cyd_wave_entry_init(&cyd->wavetable_entries[i], NULL, 0, 0, 0, 0, 0);
+			strcpy(song->wavetable_names[i], "");
+			
+			names[tail] = song->wavetable_names[i];
+			temp[tail] = cyd->wavetable_entries[i];
+		}
+	}
+	
+	memcpy(cyd->wavetable_entries, temp, n * sizeof(*temp));
+	memcpy(song->wavetable_names, names, n * sizeof(*names));
+	
+	remap_wavetables(song, remap);
+	invalidate_wavetable_items(0, n);
+	
+	free(names);
+	free(temp);
+	free(remap);
+	
+	return kept;
+}
+
+
+typedef struct
+{
+	Uint32 hash;
+	int pattern;
+} PatternHash;
+
+
+static Uint32 hash_pattern(const MusPattern *pattern)
+{
+	// FNV-1a over the same fields is_pattern_equal() compares
+	
+	Uint32 hash = 2166136261u;
+	
+	hash = (hash ^ (pattern->num_steps & 0xff)) * 16777619u;
+	hash = (hash ^ (pattern->num_steps >> 8)) * 16777619u;
+	
+	for (int i = 0 ; i < pattern->num_steps ; ++i)
+	{
+		const MusStep *step = &pattern->step[i];
 		
-		if (song->instrument[i].fm_wave == wavetable)
-			song->instrument[i].fm_wave--;
+		hash = (hash ^ step->note) * 16777619u;
+		hash = (hash ^ step->instrument) * 16777619u;
+		hash = (hash ^ step->volume) * 16777619u;
+		hash = (hash ^ step->ctrl) * 16777619u;
+		hash = (hash ^ (step->command & 0xff)) * 16777619u;
+		hash = (hash ^ (step->command >> 8)) * 16777619u;
+	}
+	
+	return hash;
+}
+
+
+static int pattern_hash_cmp(const void *_a, const void *_b)
+{
+	const PatternHash *a = _a, *b = _b;
+	
+	if (a->hash != b->hash)
+		return a->hash < b->hash ? -1 : 1;
+	
+	return a->pattern - b->pattern;
+}
+
+
+static bool merge_duplicate_patterns(MusSong *song)
+{
+	const int n = song->num_patterns;
+	
+	if (n <= 0)
+		return true;
+	
+	bool *used = calloc(n, sizeof(*used));
+	int *remap = malloc(n * sizeof(*remap));
+	PatternHash *hashes = malloc(n * sizeof(*hashes));
+	int num_hashes = 0;
+	
+	if (!used || !remap || !hashes)
+	{
+		free(hashes);
+		free(remap);
+		free(used);
+		set_info_message("Out of memory!");
+		return false;
+	}
+	
+	for (int c = 0 ; c < song->num_channels ; ++c)
+		for (int s = 0 ; s < song->num_sequences[c] ; ++s)
+			if (song->sequence[c][s].pattern < n)
+				used[song->sequence[c][s].pattern] = true;
+	
+	for (int p = 0 ; p < n ; ++p)
+	{
+		remap[p] = p;
 		
-		for (int p = 0 ; p < MUS_PROG_LEN ; ++p)
-			if ((song->instrument[i].program[p] & 0x7f00) == MUS_FX_SET_WAVETABLE_ITEM)
-			{
-				Uint8 param = song->instrument[i].program[p] & 0xff;
-				
-				if (param > wavetable)
-					song->instrument[i].program[p] = (song->instrument[i].program[p] & 0x8000) | MUS_FX_SET_WAVETABLE_ITEM | (param - 1);
-			}
+		if (used[p])
+		{
+			hashes[num_hashes].hash = hash_pattern(&song->pattern[p]);
+			hashes[num_hashes].pattern = p;
+			++num_hashes;
+		}
 	}
 	
-	for (int p = 0 ; p < song->num_patterns ; ++p)
+	// Sorting by hash (and index) puts possible duplicates next to each other
+	// with the lowest pattern number first so only those need a full compare
+	
+	qsort(hashes, num_hashes, sizeof(hashes[0]), pattern_hash_cmp);
+	
+	for (int begin = 0, end ; begin < num_hashes ; begin = end)
 	{
-		for (int i = 0 ; i < song->pattern[p].num_steps ; ++i)
+		for (end = begin + 1 ; end < num_hashes && hashes[end].hash == hashes[begin].hash ; ++end)
+			;
+		
+		for (int a = begin ; a < end ; ++a)
 		{
-			if ((song->pattern[p].step[i].command & 0xff00) == MUS_FX_SET_WAVETABLE_ITEM)
+			const int pa = hashes[a].pattern;
+			
+			if (remap[pa] != pa)
+				continue;
+			
+			for (int b = a + 1 ; b < end ; ++b)
 			{
-				Uint8 param = song->pattern[p].step[i].command & 0xff;
+				const int pb = hashes[b].pattern;
 				
-				if (param > wavetable)
-					song->pattern[p].step[i].command = MUS_FX_SET_WAVETABLE_ITEM | (param - 1);
+				if (remap[pb] == pb && is_pattern_equal(&song->pattern[pa], &song->pattern[pb]))
+					remap[pb] = pa;
 			}
 		}
 	}
 	
-	for (int i = wavetable ; i < song->num_wavetables - 1 ; ++i)
+	for (int c = 0 ; c < song->num_channels ; ++c)
+		for (int s = 0 ; s < song->num_sequences[c] ; ++s)
+			if (song->sequence[c][s].pattern < n)
+				song->sequence[c][s].pattern = remap[song->sequence[c][s].pattern];
+	
+	free(hashes);
+	free(remap);
+	free(used);
+	
+	usage_invalidate();
+	
+	return true;
+}
+
+
+static bool is_real_note(Uint8 note)
+{
+	return note < FREQ_TAB_SIZE;
+}
+
+
+static int first_real_note(const MusPattern *pattern)
+{
+	for (int i = 0 ; i < pattern->num_steps ; ++i)
+		if (is_real_note(pattern->step[i].note))
+			return pattern->step[i].note;
+	
+	return -1;
+}
+
+
+/* Like hash_pattern() but notes are hashed relative to the first note */
+
+static Uint32 hash_pattern_transposed(const MusPattern *pattern)
+{
+	Uint32 hash = 2166136261u;
+	const int base = first_real_note(pattern);
+	
+	hash = (hash ^ (pattern->num_steps & 0xff)) * 16777619u;
+	hash = (hash ^ (pattern->num_steps >> 8)) * 16777619u;
+	
+	for (int i = 0 ; i < pattern->num_steps ; ++i)
 	{
-		strcpy(song->wavetable_names[i], song->wavetable_names[i + 1]);
+		const MusStep *step = &pattern->step[i];
+		
+		if (is_real_note(step->note))
+			hash = (hash ^ ((step->note - base) & 0x7f)) * 16777619u;
+		else
+			hash = (hash ^ step->note ^ 0x80) * 16777619u;
 		
-		cyd->wavetable_entries[i].flags = cyd->wavetable_entries[i + 1].flags;
-		cyd->wavetable_entries[i].sample_rate = cyd->wavetable_entries[i + 1].sample_rate;
-		cyd->wavetable_entries[i].samples = cyd->wavetable_entries[i + 1].samples;
-		cyd->wavetable_entries[i].loop_begin = cyd->wavetable_entries[i + 1].loop_begin;
-		cyd->wavetable_entries[i].loop_end = cyd->wavetable_entries[i + 1].loop_end;
-		cyd->wavetable_entries[i].base_note = cyd->wavetable_entries[i + 1].base_note;
-		cyd->wavetable_entries[i].data = realloc(cyd->wavetable_entries[i].data, cyd->wavetable_entries[i + 1].samples * sizeof(Sint16));
-		memcpy(cyd->wavetable_entries[i].data, cyd->wavetable_entries[i + 1].data, cyd->wavetable_entries[i + 1].samples * sizeof(Sint16));
+		hash = (hash ^ step->instrument) * 16777619u;
+		hash = (hash ^ step->volume) * 16777619u;
+		hash = (hash ^ step->ctrl) * 16777619u;
+		hash = (hash ^ (step->command & 0xff)) * 16777619u;
+		hash = (hash ^ (step->command >> 8)) * 16777619u;
 	}
 	
-	strcpy(song->wavetable_names[song->num_wavetables - 1], "");
-	cyd_wave_entry_init(&cyd->wavetable_entries[song->num_wavetables - 1], NULL, 0, 0, 0, 0, 0);
+	return hash;
 }
 
 
-static void remove_pattern(MusSong *song, int p)
+/* True if every note in b is the note in a plus *semitones and all else is equal */
+
+static bool is_pattern_transposed(const MusPattern *a, const MusPattern *b, int *semitones)
 {
-	void * temp = song->pattern[p].step;
+	if (b->num_steps != a->num_steps)
+		return false;
 	
-	for (int i = 0 ; i < song->pattern[p].num_steps ; ++i)
-		zero_step(&song->pattern[p].step[i]);
-
-	for (int a = p ; a < song->num_patterns - 1 ; ++a)
+	const int base_a = first_real_note(a), base_b = first_real_note(b);
+	
+	if (base_a == -1 || base_b == -1)
+		return false;
+	
+	*semitones = base_b - base_a;
+	
+	for (int i = 0 ; i < a->num_steps ; ++i)
 	{
-		memcpy(&song->pattern[a], &song->pattern[a + 1], sizeof(song->pattern[a]));
-		replace_pattern(song, a + 1, a);
+		const MusStep *sa = &a->step[i], *sb = &b->step[i];
+		
+		if (is_real_note(sa->note))
+		{
+			if (!is_real_note(sb->note) || sb->note - sa->note != *semitones)
+				return false;
+		}
+		else if (sa->note != sb->note)
+			return false;
+		
+		if (sa->instrument != sb->instrument
+			|| sa->volume != sb->volume
+			|| sa->ctrl != sb->ctrl
+			|| sa->command != sb->command)
+			return false;
 	}
 	
-	if (song->num_patterns >= 1)
-		song->pattern[song->num_patterns - 1].step = temp;
-	
-	--song->num_patterns;
+	return true;
 }
 
 
-void optimize_duplicate_patterns(MusSong *song)
+/* Checks the sequence note offsets of pattern stay in range after adding semitones */
+
+static bool can_add_note_offset(const MusSong *song, int pattern, int semitones)
 {
-	debug("Kill unused patterns");
+	int count;
+	const UsageSeqRef *ref = usage_pattern_refs(song, pattern, &count);
 	
-	int orig_count = song->num_patterns;
+	for (int i = 0 ; i < count ; ++i)
+	{
+		const int offset = song->sequence[ref[i].channel][ref[i].slot].note_offset + semitones;
+		
+		if (offset < -128 || offset > 127)
+			return false;
+	}
+	
+	return true;
+}
 
-	for (int a = 0 ; a < song->num_patterns ; ++a)
-	{	
-		if (is_pattern_used(song, a))
+
+/* Returns the number of folded patterns or -1 if out of memory */
+
+static int fold_transposed_patterns(MusSong *song)
+{
+	const int n = song->num_patterns;
+	int folded = 0;
+	
+	if (n <= 0)
+		return 0;
+	
+	usage_invalidate();
+	
+	int *remap = malloc(n * sizeof(*remap));
+	int *transpose = calloc(n, sizeof(*transpose));
+	PatternHash *hashes = malloc(n * sizeof(*hashes));
+	int num_hashes = 0;
+	
+	if (!remap || !transpose || !hashes)
+	{
+		free(hashes);
+		free(transpose);
+		free(remap);
+		set_info_message("Out of memory!");
+		return -1;
+	}
+	
+	for (int p = 0 ; p < n ; ++p)
+	{
+		remap[p] = p;
+		
+		if (is_pattern_used(song, p) && first_real_note(&song->pattern[p]) != -1)
 		{
-			for (int b = a + 1 ; b < song->num_patterns ; ++b)
-			{	
-				if (is_pattern_used(song, b) && is_pattern_equal(&song->pattern[a], &song->pattern[b]))
+			hashes[num_hashes].hash = hash_pattern_transposed(&song->pattern[p]);
+			hashes[num_hashes].pattern = p;
+			++num_hashes;
+		}
+	}
+	
+	qsort(hashes, num_hashes, sizeof(hashes[0]), pattern_hash_cmp);
+	
+	for (int begin = 0, end ; begin < num_hashes ; begin = end)
+	{
+		for (end = begin + 1 ; end < num_hashes && hashes[end].hash == hashes[begin].hash ; ++end)
+			;
+		
+		for (int a = begin ; a < end ; ++a)
+		{
+			const int pa = hashes[a].pattern;
+			
+			if (remap[pa] != pa)
+				continue;
+			
+			for (int b = a + 1 ; b < end ; ++b)
+			{
+				const int pb = hashes[b].pattern;
+				int semitones;
+				
+				if (remap[pb] == pb && is_pattern_transposed(&song->pattern[pa], &song->pattern[pb], &semitones)
+					&& can_add_note_offset(song, pb, semitones))
 				{
-					replace_pattern(song, b, a);
+					debug("Pattern %x is pattern %x transposed by %d", pb, pa, semitones);
+					remap[pb] = pa;
+					transpose[pb] = semitones;
+					++folded;
 				}
 			}
 		}
 	}
 	
-	for (int a = 0 ; a < song->num_patterns ; )
-	{	
-		if (!is_pattern_used(song, a))
+	for (int c = 0 ; c < song->num_channels ; ++c)
+		for (int s = 0 ; s < song->num_sequences[c] ; ++s)
 		{
-			remove_pattern(song, a);
+			MusSeqPattern *sp = &song->sequence[c][s];
+			
+			if (sp->pattern < n)
+			{
+				sp->note_offset += transpose[sp->pattern];
+				sp->pattern = remap[sp->pattern];
+			}
 		}
-		else 
-			++a;
+	
+	free(hashes);
+	free(transpose);
+	free(remap);
+	
+	usage_invalidate();
+	
+	return folded;
+}
+
+
+static void remove_unused_patterns(MusSong *song)
+{
+	int orig_count = song->num_patterns;
+	
+	// Not every edit goes through snapshot(), rebuild before deleting anything
+	
+	usage_invalidate();
+	
+	bool *keep = malloc(song->num_patterns * sizeof(*keep));
+	
+	if (!keep)
+	{
+		set_info_message("Out of memory!");
+		return;
+	}
+	
+	for (int a = 0 ; a < song->num_patterns ; ++a)
+		keep[a] = is_pattern_used(song, a);
+	
+	const int kept = compact_patterns(song, keep);
+	
+	free(keep);
+	
+	if (kept < 0)
+	{
+		set_info_message("Out of memory!");
+		return;
 	}
 	
+	song->num_patterns = kept;
+	
 	set_info_message("Reduced number of patterns from %d to %d", orig_count, song->num_patterns);
 	
 	song->num_patterns = NUM_PATTERNS;
 }
 
 
-void optimize_unused_instruments(MusSong *song)
+void optimize_duplicate_patterns(MusSong *song)
 {
-	int removed = 0;
+	debug("Kill unused patterns");
 	
+	if (merge_duplicate_patterns(song))
+		remove_unused_patterns(song);
+}
+
+
+void optimize_transposed_patterns(MusSong *song)
+{
+	debug("Fold transposed patterns");
+	
+	if (merge_duplicate_patterns(song) && fold_transposed_patterns(song) >= 0)
+		remove_unused_patterns(song);
+}
+
+
+void optimize_unused_instruments(MusSong *song)
+{
 	debug("Kill unused instruments");
 	
+	usage_invalidate();
+	
+	bool *keep = malloc(song->num_instruments * sizeof(*keep));
+	
+	if (!keep)
+	{
+		set_info_message("Out of memory!");
+		return;
+	}
+	
 	for (int i = 0 ; i < song->num_instruments ; ++i)
-		if (!is_instrument_used(song, i))
-		{
-			remove_instrument(song, i);
-			++removed;
-		}
-		
+		keep[i] = is_instrument_used(song, i);
+	
+	const int kept = compact_instruments(song, keep);
+	
+	free(keep);
+	
+	if (kept < 0)
+	{
+		set_info_message("Out of memory!");
+		return;
+	}
+	
+	const int removed = song->num_instruments - kept;
+	
 	set_info_message("Removed %d unused instruments", removed);
 }
 
 
 void optimize_unused_wavetables(MusSong *song, CydEngine *cyd)
 {
-	int removed = 0;
-	
 	debug("Kill unused wavetables");
 	
+	usage_invalidate();
+	
+	bool *keep = malloc(song->num_wavetables * sizeof(*keep));
+	
+	if (!keep)
+	{
+		set_info_message("Out of memory!");
+		return;
+	}
+	
 	for (int i = 0 ; i < song->num_wavetables ; ++i)
-		if (!is_wavetable_used(song, i))
-		{
-			remove_wavetable(song, cyd, i);
-			++removed;
-		}
-		
+		keep[i] = is_wavetable_used(song, i);
+	
+	const int kept = compact_wavetables(song, cyd, keep);
+	
+	free(keep);
+	
+	if (kept < 0)
+	{
+		set_info_message("Out of memory!");
+		return;
+	}
+	
+	const int removed = song->num_wavetables - kept;
+	
 	set_info_message("Removed %d unused wavetables", removed);
 }
 
-void kill_duplicate_wavetables(MusSong *song, CydEngine *cyd) //wasn't there
+typedef struct
+{
+	Uint32 hash;
+	int wavetable;
+	Uint32 length; // samples compared, i.e. without trailing silence if allowed
+	Uint32 samples; // whole item
+} WaveHash;
+
+
+static Uint32 fnv_add(Uint32 hash, Uint32 value)
+{
+	for (int i = 0 ; i < 4 ; ++i, value >>= 8)
+		hash = (hash ^ (value & 0xff)) * 16777619u;
+	
+	return hash;
+}
+
+
+static Uint32 wave_compare_length(const CydWavetableEntry *w, Uint32 flags)
+{
+	if (!(flags & WAVE_DEDUP_TRAILING_SILENCE))
+		return w->samples;
+	
+	Uint32 length = w->samples;
+	
+	while (length > 0 && w->data[length - 1] == 0)
+		--length;
+	
+	// looped waves can only lose silence that is never played
+	
+	if ((w->flags & CYD_WAVE_LOOP) && w->loop_end > length)
+		return w->samples;
+	
+	return length;
+}
+
+
+static bool is_wave_meta_equal(const CydWavetableEntry *a, const CydWavetableEntry *b, Uint32 flags)
+{
+	if (a->flags != b->flags || a->sample_rate != b->sample_rate || a->base_note != b->base_note)
+		return false;
+	
+	if (!(flags & WAVE_DEDUP_TRAILING_SILENCE) && a->samples != b->samples)
+		return false;
+	
+	if (!(flags & WAVE_DEDUP_TRAILING_SILENCE) || (a->flags & CYD_WAVE_LOOP))
+		return a->loop_begin == b->loop_begin && a->loop_end == b->loop_end;
+	
+	return true;
+}
+
+
+static Uint32 hash_wave(const CydWavetableEntry *w, Uint32 length, Uint32 flags)
+{
+	Uint32 hash = 2166136261u;
+	
+	hash = fnv_add(hash, w->flags);
+	hash = fnv_add(hash, w->sample_rate);
+	hash = fnv_add(hash, w->base_note);
+	hash = fnv_add(hash, length);
+	
+	if (!(flags & WAVE_DEDUP_TRAILING_SILENCE) || (w->flags & CYD_WAVE_LOOP))
+	{
+		hash = fnv_add(hash, w->loop_begin);
+		hash = fnv_add(hash, w->loop_end);
+	}
+	
+	const Uint8 *data = (const Uint8*)w->data;
+	
+	for (Uint32 i = 0 ; i < length * sizeof(w->data[0]) ; ++i)
+		hash = (hash ^ data[i]) * 16777619u;
+	
+	return hash;
+}
+
+
+static int wave_hash_cmp(const void *_a, const void *_b)
+{
+	const WaveHash *a = _a, *b = _b;
+	
+	if (a->hash != b->hash)
+		return a->hash < b->hash ? -1 : 1;
+	
+	// Equal hashes mean equal compared lengths, so prefer the item with the
+	// least trailing silence, then the lowest numbered one as the one to keep
+	
+	if (a->samples != b->samples)
+		return a->samples < b->samples ? -1 : 1;
+	
+	return a->wavetable - b->wavetable;
+}
+
+
+void kill_duplicate_wavetables(MusSong *song, CydEngine *cyd, Uint32 flags) //wasn't there
 {
 	int removed = 0;
 	
 	debug("Kill duplicate wavetables");
 	debug("Wavetables: %d", song->num_wavetables);
 	
-	for (int i = 0 ; i <= song->num_wavetables ; ++i)
+	const int n = song->num_wavetables;
+	WaveHash *hashes = malloc(n * sizeof(*hashes));
+	int *remap = malloc(n * sizeof(*remap));
+	int num_hashes = 0;
+	
+	if (!hashes || !remap)
+	{
+		free(remap);
+		free(hashes);
+		set_info_message("Out of memory!");
+		return;
+	}
+	
+	for (int i = 0 ; i < n ; ++i)
+	{
+		const CydWavetableEntry *w = &cyd->wavetable_entries[i];
+		
+		remap[i] = i;
+		
+		if (w->samples == 0 || w->sample_rate == 0 || !w->data)
+			continue;
+		
+		// samples are compared in their decoded 16-bit form so 8-bit sources work too
+		
+		hashes[num_hashes].length = wave_compare_length(w, flags);
+		hashes[num_hashes].hash = hash_wave(w, hashes[num_hashes].length, flags);
+		hashes[num_hashes].samples = w->samples;
+		hashes[num_hashes].wavetable = i;
+		++num_hashes;
+	}
+	
+	qsort(hashes, num_hashes, sizeof(hashes[0]), wave_hash_cmp);
+	
+	for (int begin = 0, end ; begin < num_hashes ; begin = end)
 	{
-		for(int j = 0; j <= song->num_wavetables ; ++j)
+		for (end = begin + 1 ; end < num_hashes && hashes[end].hash == hashes[begin].hash ; ++end)
+			;
+		
+		for (int a = begin ; a < end ; ++a)
 		{
-			if(i != j)
+			const int wa = hashes[a].wavetable;
+			const CydWavetableEntry *ea = &cyd->wavetable_entries[wa];
+			
+			if (remap[wa] != wa)
+				continue;
+			
+			for (int b = a + 1 ; b < end ; ++b)
 			{
-				if(cyd->wavetable_entries[i].flags == cyd->wavetable_entries[j].flags &&
-					cyd->wavetable_entries[i].sample_rate == cyd->wavetable_entries[j].sample_rate &&
-					cyd->wavetable_entries[i].samples == cyd->wavetable_entries[j].samples &&
-					cyd->wavetable_entries[i].loop_begin == cyd->wavetable_entries[j].loop_begin &&
-					cyd->wavetable_entries[i].loop_end == cyd->wavetable_entries[j].loop_end &&
-					cyd->wavetable_entries[i].base_note == cyd->wavetable_entries[j].base_note && 
-					cyd->wavetable_entries[i].sample_rate != 0 && 
-					cyd->wavetable_entries[i].samples != 0 &&
-					strcmp(song->wavetable_names[j], song->wavetable_names[i]) == 0)
+				const int wb = hashes[b].wavetable;
+				const CydWavetableEntry *eb = &cyd->wavetable_entries[wb];
+				
+				if (remap[wb] == wb && hashes[a].length == hashes[b].length && is_wave_meta_equal(ea, eb, flags)
+					&& memcmp(ea->data, eb->data, hashes[a].length * sizeof(ea->data[0])) == 0)
 				{
-					Uint8 flag = 0;
+					debug("Killing wavetable number %d (same as %d)", wb, wa);
 					
-					for(int k = 0; k < cyd->wavetable_entries[j].samples; k++) //TODO: add support for 8-bit samples
-					{
-						if(*(cyd->wavetable_entries[i].data + k) != *(cyd->wavetable_entries[j].data + k))
-						{
-							flag++;
-						}
-					}
+					remap[wb] = wa;
 					
-					if(flag == 0)
-					{
-						debug("Killing wavetable number %d", j);
-						
-						for (int h = 0; h < song->num_instruments; ++h)
-						{
-							if (song->instrument[h].wavetable_entry == j)
-								song->instrument[h].wavetable_entry = i;
-							
-							if (song->instrument[h].fm_wave == j)
-								song->instrument[h].fm_wave = i;
-							
-							for (int p = 0 ; p < MUS_PROG_LEN ; ++p)
-							{
-								if ((song->instrument[h].program[p] & 0x3B00) == 0x3B00 && (song->instrument[h].program[p] & 0x00FF) == j && (song->instrument[h].program[p] & 0xFF00) != 0xFF00)
-								{
-									song->instrument[h].program[p] = 0x3B00 + i;
-								}
-							}
-						}
-						
-						for (int p = 0 ; p < song->num_patterns ; ++p)
-						{
-							for (int w = 0 ; w < song->pattern[p].num_steps ; ++w)
-							{
-								if ((song->pattern[p].step[w].command & 0x3B00) == 0x3B00 && (song->pattern[p].step[w].command & 0x00FF) == j && (song->pattern[p].step[w].command & 0xFF00) != 0xFF00)
-								{
-									song->pattern[p].step[w].command = 0x3B00 + i;
-								}
-							}
-						}
-						
-						strcpy(song->wavetable_names[i], song->wavetable_names[j]);
-						
-						cyd_wave_entry_init(&cyd->wavetable_entries[j], NULL, 0, 0, 0, 0, 0);
-
-						strcpy(mused.song.wavetable_names[j], "");
-			
-						removed++;
-					}
+					if (!song->wavetable_names[wa][0])
+						strcpy(song->wavetable_names[wa], song->wavetable_names[wb]);
+					
+					++removed;
 				}
 			}
 		}
 	}
 	
+	if (removed)
+	{
+		remap_wavetables(song, remap);
+		
+		for (int i = 0 ; i < n ; ++i)
+			if (remap[i] != i)
+			{
+				cyd_wave_entry_init(&cyd->wavetable_entries[i], NULL, 0, 0, 0, 0, 0);
+				strcpy(song->wavetable_names[i], "");
+			}
+		
+		invalidate_wavetable_items(0, n);
+	}
+	
+	free(remap);
+	free(hashes);
+	
 	debug("Removed %d duplicate wavetables", removed);
+	
 	set_info_message("Removed %d duplicate wavetables", removed);
 }
 
@@ -398,9 +908,10 @@ void optimize_song(MusSong *song)
 	debug("Optimizing song");
 	optimize_duplicate_patterns(song);
 	optimize_unused_instruments(&mused.song);
-	optimize_unused_wavetables(&mused.song, &mused.cyd);
 	
-	kill_duplicate_wavetables(&mused.song, &mused.cyd); //wasn't there
+	kill_duplicate_wavetables(&mused.song, &mused.cyd, 0); //wasn't there
+	
+	optimize_unused_wavetables(&mused.song, &mused.cyd);
 	
 	set_info_message("Removed unused song data");
 }
@@ -412,6 +923,12 @@ void optimize_patterns_action(void *unused1, void *unused2, void *unused3)
 }
 
 
+void optimize_transposed_patterns_action(void *unused1, void *unused2, void *unused3)
+{
+	optimize_transposed_patterns(&mused.song);
+}
+
+
 void optimize_instruments_action(void *unused1, void *unused2, void *unused3)
 {
 	optimize_unused_instruments(&mused.song);
@@ -423,7 +940,7 @@ void optimize_wavetables_action(void *unused1, void *unused2, void *unused3)
 	optimize_unused_wavetables(&mused.song, &mused.cyd);
 }
 
-void duplicate_wavetables_action(void *unused1, void *unused2, void *unused3) //wasn't there
+void duplicate_wavetables_action(void *flags, void *unused2, void *unused3) //wasn't there
 {
-	kill_duplicate_wavetables(&mused.song, &mused.cyd);
+	kill_duplicate_wavetables(&mused.song, &mused.cyd, CASTPTR(int, flags));
 }
@@ -29,17 +29,25 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "snd/music.h"
 #include <stdbool.h>
 
+enum
+{
+	WAVE_DEDUP_TRAILING_SILENCE = 1
+};
+
 void optimize_duplicate_patterns(MusSong *song);
+void optimize_transposed_patterns(MusSong *song);
 void optimize_song(MusSong *song);
 bool is_pattern_empty(const MusPattern *a);
 bool is_pattern_equal(const MusPattern *a, const MusPattern *b);
 bool is_instrument_used(const MusSong *song, int instrument);
 bool is_wavetable_used(const MusSong *song, int wavetable);
+void kill_duplicate_wavetables(MusSong *song, CydEngine *cyd, Uint32 flags);
 
 void optimize_patterns_action(void *unused1, void *unused2, void *unused3);
+void optimize_transposed_patterns_action(void *unused1, void *unused2, void *unused3);
 void optimize_instruments_action(void *unused1, void *unused2, void *unused3);
 void optimize_wavetables_action(void *unused1, void *unused2, void *unused3);
 
-void duplicate_wavetables_action(void *unused1, void *unused2, void *unused3); //wasn't there
+void duplicate_wavetables_action(void *flags, void *unused2, void *unused3); //wasn't there
 
 #endif
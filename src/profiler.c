@@ -0,0 +1,461 @@
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "profiler.h"
+#include "mused.h"
+#include "view.h"
+#include "gui/bevel.h"
+#include "gui/bevdefs.h"
+#include "gui/dialog.h"
+#include "gui/mouse.h"
+#include "gui/toolutil.h"
+#include "gui/slider.h"
+#include "gfx/font.h"
+#include <string.h>
+#include <stdlib.h>
+
+#define SCROLLBAR 10
+#define MARGIN 8
+#define SCREENMARGIN 32
+#define TITLE 14
+#define CLOSE_BUTTON 12
+#define BUTTONS 16
+
+extern GfxDomain *domain;
+
+enum
+{
+	SORT_COST,
+	SORT_ITEM
+};
+
+static struct
+{
+	const Profile *profile;
+	const MusSong *song;
+	int sort;
+	int order[PROF_MAX_ROWS];
+	int list_position;
+	SliderParam scrollbar;
+	int quit;
+} data;
+
+
+static bool render_pass(Profile *profile, MusSong *song, CydWavetableEntry *entries, int position, int sample_rate, int solo, double baseline, double *total, int *chunks)
+{
+	MusEngine mus;
+	CydEngine cyd;
+	
+	cyd_init(&cyd, sample_rate, MUS_MAX_CHANNELS);
+	cyd.flags |= CYD_SINGLE_THREAD;
+	mus_init_engine(&mus, &cyd);
+	mus.volume = song->master_volume;
+	mus_set_fx(&mus, song);
+	CydWavetableEntry * prev_entry = cyd.wavetable_entries; // save entries so they can be free'd
+	cyd.wavetable_entries = entries;
+	cyd_set_callback(&cyd, mus_advance_tick, &mus, song->song_rate);
+	mus_set_song(&mus, song, position);
+	
+	for (int i = 0 ; i < MUS_MAX_CHANNELS ; ++i)
+	{
+		if (i == solo)
+			mus.channel[i].flags &= ~MUS_CHN_DISABLED;
+		else
+			mus.channel[i].flags |= MUS_CHN_DISABLED;
+	}
+	
+	Sint16 buffer[PROF_CHUNK * 2];
+	const double freq = SDL_GetPerformanceFrequency();
+	const int max_chunks = (Sint64)PROF_WINDOW * sample_rate / PROF_CHUNK;
+	bool success = true;
+	
+	*total = 0;
+	
+	for (*chunks = 0 ; *chunks < max_chunks && mus.song_position < song->song_length ; ++*chunks)
+	{
+		memset(buffer, 0, sizeof(buffer));
+		
+		const Uint64 start = SDL_GetPerformanceCounter();
+		cyd_output_buffer_stereo(&cyd, (Uint8*)buffer, sizeof(buffer));
+		const double t = (SDL_GetPerformanceCounter() - start) / freq;
+		
+		*total += t;
+		
+		if (solo >= 0)
+		{
+			// Whatever the channel is playing right now pays for this block.
+			// Blocks faster than the baseline count too so that timer noise
+			// cancels out like it does for the channel rows.
+			
+			const MusInstrument *inst = mus.channel[solo].instrument;
+			
+			if (inst >= song->instrument && inst < song->instrument + song->num_instruments)
+			{
+				const int idx = inst - song->instrument;
+				
+				profile->row[MUS_MAX_CHANNELS + idx].time += t - baseline;
+				
+				if ((inst->cydflags & CYD_CHN_ENABLE_FX) && inst->fx_bus < CYD_MAX_FX_CHANNELS)
+					profile->row[MUS_MAX_CHANNELS + 256 + inst->fx_bus].time += t - baseline;
+			}
+		}
+		
+		if ((*chunks % 256) == 0 && !progress_box("Profiling...", (solo + 1) * max_chunks + *chunks, (song->num_channels + 1) * max_chunks))
+		{
+			success = false;
+			break;
+		}
+	}
+	
+	cyd.wavetable_entries = prev_entry;
+	
+	cyd_deinit(&cyd);
+	
+	return success;
+}
+
+
+bool profile_song(Profile *profile, MusSong *song, CydWavetableEntry *entries, int position, int sample_rate)
+{
+	memset(profile, 0, sizeof(*profile));
+	
+	for (int i = 0 ; i < PROF_MAX_ROWS ; ++i)
+	{
+		if (i < MUS_MAX_CHANNELS)
+		{
+			profile->row[i].type = PR_CHANNEL;
+			profile->row[i].idx = i;
+		}
+		else if (i < MUS_MAX_CHANNELS + 256)
+		{
+			profile->row[i].type = PR_INSTRUMENT;
+			profile->row[i].idx = i - MUS_MAX_CHANNELS;
+		}
+		else
+		{
+			profile->row[i].type = PR_FX_BUS;
+			profile->row[i].idx = i - MUS_MAX_CHANNELS - 256;
+		}
+	}
+	
+	profile->n_rows = PROF_MAX_ROWS;
+	
+	song->flags |= MUS_NO_REPEAT;
+	
+	double total;
+	int chunks;
+	bool success = render_pass(profile, song, entries, position, sample_rate, -1, 0, &total, &chunks);
+	
+	if (success && chunks > 0)
+	{
+		profile->baseline_time = total;
+		profile->audio_time = (double)chunks * PROF_CHUNK / sample_rate;
+		
+		const double baseline = total / chunks;
+		
+		for (int c = 0 ; c < song->num_channels && success ; ++c)
+		{
+			success = render_pass(profile, song, entries, position, sample_rate, c, baseline, &total, &chunks);
+			profile->row[c].time = my_max(0, total - baseline * chunks);
+			profile->channel_time += profile->row[c].time;
+		}
+		
+		for (int i = MUS_MAX_CHANNELS ; i < PROF_MAX_ROWS ; ++i)
+			profile->row[i].time = my_max(0, profile->row[i].time);
+	}
+	
+	song->flags &= ~MUS_NO_REPEAT;
+	
+	return success;
+}
+
+
+static void row_name(char *name, size_t size, const ProfRow *row, const MusSong *song)
+{
+	switch (row->type)
+	{
+		case PR_CHANNEL: snprintf(name, size, "Channel %02d", row->idx); break;
+		case PR_INSTRUMENT: snprintf(name, size, "Instrument %02X %s", row->idx, song->instrument[row->idx].name); break;
+		case PR_FX_BUS: snprintf(name, size, "Routed to FX bus %d", row->idx); break;
+	}
+}
+
+
+bool profile_export(FILE *f, const Profile *profile, const MusSong *song)
+{
+	fprintf(f, "type,index,name,ms,percent_dsp,percent_realtime\n");
+	
+	static const char *type_name[] = { "channel", "instrument", "fx_bus_routed" };
+	
+	for (int i = 0 ; i < profile->n_rows ; ++i)
+	{
+		const ProfRow *row = &profile->row[i];
+		
+		if (row->time <= 0)
+			continue;
+		
+		char name[100];
+		row_name(name, sizeof(name), row, song);
+		
+		// Names are user text
+		for (char *c = name ; *c ; ++c)
+			if (*c == ',' || *c == '"') *c = ' ';
+		
+		fprintf(f, "%s,%d,%s,%.3f,%.1f,%.1f\n", type_name[row->type], row->idx, name, row->time * 1000,
+			profile->channel_time > 0 ? row->time * 100 / profile->channel_time : 0.0,
+			profile->audio_time > 0 ? row->time * 100 / profile->audio_time : 0.0);
+	}
+	
+	return !ferror(f);
+}
+
+
+static int compare_rows(const void *_a, const void *_b)
+{
+	const ProfRow *a = &data.profile->row[*(const int*)_a];
+	const ProfRow *b = &data.profile->row[*(const int*)_b];
+	
+	if (data.sort == SORT_COST && a->time != b->time)
+		return a->time < b->time ? 1 : -1;
+	
+	if (a->type != b->type)
+		return (int)a->type - (int)b->type;
+	
+	return a->idx - b->idx;
+}
+
+
+static int visible_rows()
+{
+	int n = 0;
+	
+	for (int i = 0 ; i < data.profile->n_rows ; ++i)
+		if (data.profile->row[i].time > 0)
+			data.order[n++] = i;
+	
+	qsort(data.order, n, sizeof(data.order[0]), compare_rows);
+	
+	return n;
+}
+
+
+static void set_sort(void *sort, void *unused1, void *unused2)
+{
+	data.sort = CASTPTR(int, sort);
+}
+
+
+static void save_csv(void *unused0, void *unused1, void *unused2)
+{
+	char def[1000], filename[5000];
+	
+	snprintf(def, sizeof(def), "%s-profile.csv", data.song->title);
+	
+	if (open_dialog_fn("wb", "Export profile", "csv", domain, mused.slider_bevel, &mused.largefont, &mused.smallfont, def, filename, sizeof(filename)))
+	{
+		FILE *f = fopen(filename, "wb");
+		
+		if (f)
+		{
+			profile_export(f, data.profile, data.song);
+			fclose(f);
+		}
+	}
+}
+
+
+static void window_view(GfxDomain *dest_surface, const SDL_Rect *area, const SDL_Event *event, void *param)
+{
+	bevel(dest_surface, area, mused.slider_bevel, BEV_MENU);
+}
+
+
+static void title_view(GfxDomain *dest_surface, const SDL_Rect *area, const SDL_Event *event, void *param)
+{
+	SDL_Rect titlearea, button;
+	copy_rect(&titlearea, area);
+	titlearea.w -= CLOSE_BUTTON - 4;
+	copy_rect(&button, area);
+	adjust_rect(&button, titlearea.h - CLOSE_BUTTON);
+	button.w = CLOSE_BUTTON;
+	button.x = area->w + area->x - CLOSE_BUTTON;
+	font_write_args(&mused.largefont, dest_surface, &titlearea, "CPU profile (%d s, baseline %.1f%%)", (int)(data.profile->audio_time + 0.5),
+		data.profile->audio_time > 0 ? data.profile->baseline_time * 100 / data.profile->audio_time : 0.0);
+	if (button_event(dest_surface, event, &button, mused.slider_bevel, BEV_BUTTON, BEV_BUTTON_ACTIVE, DECAL_CLOSE, NULL, MAKEPTR(1), 0, 0) & 1)
+		data.quit = 1;
+}
+
+
+static void list_view(GfxDomain *dest_surface, const SDL_Rect *area, const SDL_Event *event, void *param)
+{
+	SDL_Rect content, pos;
+	copy_rect(&content, area);
+	adjust_rect(&content, 1);
+	copy_rect(&pos, &content);
+	pos.h = mused.largefont.h;
+	bevel(dest_surface, area, mused.slider_bevel, BEV_FIELD);
+	
+	const int n = visible_rows();
+	
+	gfx_domain_set_clip(dest_surface, &content);
+	
+	for (int i = data.list_position ; i < n && pos.y < content.h + content.y ; ++i)
+	{
+		const ProfRow *row = &data.profile->row[data.order[i]];
+		char name[100];
+		row_name(name, sizeof(name), row, data.song);
+		
+		font_write_args(&mused.smallfont, dest_surface, &pos, "%-32.32s %9.2f ms %5.1f%% of DSP %5.1f%% of realtime", name, row->time * 1000,
+			data.profile->channel_time > 0 ? row->time * 100 / data.profile->channel_time : 0.0,
+			data.profile->audio_time > 0 ? row->time * 100 / data.profile->audio_time : 0.0);
+		
+		if (pos.y + pos.h <= content.h + content.y) slider_set_params(&data.scrollbar, 0, n - 1, data.list_position, i, &data.list_position, 1, SLIDER_VERTICAL, mused.slider_bevel);
+		
+		update_rect(&content, &pos);
+	}
+	
+	gfx_domain_set_clip(dest_surface, NULL);
+	
+	check_mouse_wheel_event(event, area, &data.scrollbar);
+}
+
+
+static void buttons_view(GfxDomain *dest_surface, const SDL_Rect *area, const SDL_Event *event, void *param)
+{
+	SDL_Rect button;
+	
+	copy_rect(&button, area);
+	
+	button.w = strlen("By cost") * mused.smallfont.w + 12;
+	button_text_event(dest_surface, event, &button, mused.slider_bevel, &mused.smallfont, data.sort == SORT_COST ? BEV_BUTTON_ACTIVE : BEV_BUTTON, BEV_BUTTON_ACTIVE, "By cost", set_sort, MAKEPTR(SORT_COST), 0, 0);
+	button.x += button.w + 1;
+	
+	button.w = strlen("By item") * mused.smallfont.w + 12;
+	button_text_event(dest_surface, event, &button, mused.slider_bevel, &mused.smallfont, data.sort == SORT_ITEM ? BEV_BUTTON_ACTIVE : BEV_BUTTON, BEV_BUTTON_ACTIVE, "By item", set_sort, MAKEPTR(SORT_ITEM), 0, 0);
+	button.x += button.w + 1;
+	
+	button.w = strlen("Save CSV") * mused.smallfont.w + 12;
+	button_text_event(dest_surface, event, &button, mused.slider_bevel, &mused.smallfont, BEV_BUTTON, BEV_BUTTON_ACTIVE, "Save CSV", save_csv, 0, 0, 0);
+}
+
+
+static const View profile_view[] =
+{
+	{{ SCREENMARGIN, SCREENMARGIN, -SCREENMARGIN, -SCREENMARGIN }, window_view, &data, -1},
+	{{ MARGIN+SCREENMARGIN, SCREENMARGIN+MARGIN, -MARGIN-SCREENMARGIN, TITLE - 2 }, title_view, &data, -1},
+	{{ -SCROLLBAR-MARGIN-SCREENMARGIN, SCREENMARGIN+MARGIN + TITLE, SCROLLBAR, -MARGIN-SCREENMARGIN-BUTTONS }, slider, &data.scrollbar, -1},
+	{{ SCREENMARGIN+MARGIN, SCREENMARGIN+MARGIN + TITLE, -SCROLLBAR-MARGIN-1-SCREENMARGIN, -MARGIN-SCREENMARGIN-BUTTONS }, list_view, &data, -1},
+	{{ SCREENMARGIN+MARGIN, -SCREENMARGIN-MARGIN-BUTTONS+2, -MARGIN-SCREENMARGIN, BUTTONS-2 }, buttons_view, &data, -1},
+	{{0, 0, 0, 0}, NULL}
+};
+
+
+static void profile_box(const Profile *profile, const MusSong *song)
+{
+	set_repeat_timer(NULL);
+	
+	memset(&data, 0, sizeof(data));
+	data.profile = profile;
+	data.song = song;
+	data.sort = SORT_COST;
+	
+	slider_set_params(&data.scrollbar, 0, 0, data.list_position, 0, &data.list_position, 1, SLIDER_VERTICAL, mused.slider_bevel);
+	
+	while (!data.quit)
+	{
+		SDL_Event e = { 0 };
+		int got_event = 0;
+		
+		while (SDL_PollEvent(&e))
+		{
+			switch (e.type)
+			{
+				case SDL_QUIT:
+				set_repeat_timer(NULL);
+				SDL_PushEvent(&e);
+				return;
+				
+				case SDL_KEYDOWN:
+				if (e.key.keysym.sym == SDLK_ESCAPE)
+				{
+					set_repeat_timer(NULL);
+					return;
+				}
+				break;
+				
+				case SDL_USEREVENT:
+					e.type = SDL_MOUSEBUTTONDOWN;
+				break;
+				
+				case SDL_MOUSEMOTION:
+					e.motion.xrel /= domain->scale;
+					e.motion.yrel /= domain->scale;
+					e.button.x /= domain->scale;
+					e.button.y /= domain->scale;
+				break;
+				
+				case SDL_MOUSEBUTTONDOWN:
+					e.button.x /= domain->scale;
+					e.button.y /= domain->scale;
+				break;
+				
+				case SDL_MOUSEBUTTONUP:
+					if (e.button.button == SDL_BUTTON_LEFT)
+						mouse_released(&e);
+				break;
+			}
+			
+			if (e.type != SDL_MOUSEMOTION || (e.motion.state)) ++got_event;
+			
+			// ensure the last event is a mouse click so it gets passed to the draw/event code
+			
+			if (e.type == SDL_MOUSEBUTTONDOWN || (e.type == SDL_MOUSEMOTION && e.motion.state)) break; 
+		}
+		
+		if (got_event || gfx_domain_is_next_frame(domain))
+		{
+			draw_view(domain, profile_view, &e);
+			gfx_domain_flip(domain);
+		}
+		else
+			SDL_Delay(5);
+	}
+}
+
+
+void profile_song_action(void *unused1, void *unused2, void *unused3)
+{
+	Profile *profile = malloc(sizeof(*profile));
+	
+	if (!profile)
+		return;
+	
+	if (profile_song(profile, &mused.song, mused.mus.cyd->wavetable_entries, mused.current_sequencepos, mused.mix_rate))
+		profile_box(profile, &mused.song);
+	else
+		set_info_message("Profiling aborted");
+	
+	free(profile);
+}
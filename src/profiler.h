@@ -0,0 +1,77 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SDL.h"
+#include "snd/music.h"
+#include <stdio.h>
+#include <stdbool.h>
+
+/*
+Attributes mixer time to channels and instruments. The song is rendered
+offline once with every channel muted and once per channel solo; the time
+over the muted baseline is charged to the soloed channel and to the
+instrument it was playing at that moment.
+
+The FX bus rows sum the time of the channels routed to each bus, bus
+processing included. They are not the cost of the bus effects alone.
+*/
+
+#define PROF_WINDOW 20 // seconds of song profiled from the cursor
+#define PROF_CHUNK 256 // samples per timed block
+#define PROF_MAX_ROWS (MUS_MAX_CHANNELS + 256 + CYD_MAX_FX_CHANNELS) // instrument numbers fit in a byte
+
+typedef enum
+{
+	PR_CHANNEL,
+	PR_INSTRUMENT,
+	PR_FX_BUS // channels routed to the bus, see above
+} ProfRowType;
+
+typedef struct
+{
+	ProfRowType type;
+	int idx;
+	double time; // seconds
+} ProfRow;
+
+typedef struct
+{
+	double audio_time; // length of the window
+	double baseline_time; // rendering with all channels muted
+	double channel_time; // sum of channel rows
+	int n_rows;
+	ProfRow row[PROF_MAX_ROWS];
+} Profile;
+
+/* Returns false if aborted */
+bool profile_song(Profile *profile, MusSong *song, CydWavetableEntry *entries, int position, int sample_rate);
+bool profile_export(FILE *f, const Profile *profile, const MusSong *song);
+
+void profile_song_action(void *unused1, void *unused2, void *unused3);
+
+#endif
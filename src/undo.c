@@ -46,6 +46,9 @@ static UndoEvent * get_frame(UndoType type, UndoStack *stack, bool modified)
 	if (inside_undo) return NULL;
 	
 	UndoFrame *frame = calloc(sizeof(UndoFrame), 1);
+	
+	if (!frame) return NULL;
+	
 	undo_add_frame(stack, frame);
 	frame->type = type;
 	frame->modified = modified;
@@ -78,6 +81,17 @@ void undo_destroy_frame(UndoFrame *frame)
 			free(frame->event.wave_name.name);
 			break;
 			
+		case UNDO_WAVE_RANGE:
+			free(frame->event.wave_range.data);
+			break;
+			
+		case UNDO_WAVE_BATCH:
+			for (int i = 0 ; i < frame->event.wave_batch.count ; ++i)
+				free(frame->event.wave_batch.entry[i].data);
+			
+			free(frame->event.wave_batch.entry);
+			break;
+			
 		default: break;
 	}
 
@@ -242,6 +256,64 @@ void undo_store_wave_data(UndoStack *stack, int idx, const CydWavetableEntry *en
 }
 
 
+void undo_store_wave_range(UndoStack *stack, int idx, int first, int length, const Sint16 *data, bool modified)
+{
+	UndoEvent *frame = get_frame(UNDO_WAVE_RANGE, stack, modified);
+	
+	if (!frame) return;
+	
+	frame->wave_range.idx = idx;
+	frame->wave_range.first = first;
+	frame->wave_range.length = length;
+	frame->wave_range.data = malloc(length * sizeof(data[0]));
+	memcpy(frame->wave_range.data, data, length * sizeof(data[0]));
+}
+
+
+bool undo_store_wave_batch(UndoStack *stack, int first, int count, const CydWavetableEntry *entries, bool modified)
+{
+	UndoEvent *frame = get_frame(UNDO_WAVE_BATCH, stack, modified);
+	
+	if (!frame) return inside_undo;
+	
+	frame->wave_batch.first = first;
+	frame->wave_batch.count = 0;
+	frame->wave_batch.entry = malloc(count * sizeof(entries[0]));
+	
+	if (!frame->wave_batch.entry)
+	{
+		undo_pop(stack);
+		return false;
+	}
+	
+	for (int i = 0 ; i < count ; ++i)
+	{
+		CydWavetableEntry *entry = &frame->wave_batch.entry[i];
+		
+		*entry = entries[i];
+		entry->data = NULL;
+		
+		if (entries[i].samples > 0)
+		{
+			entry->data = malloc(entries[i].samples * sizeof(entries[i].data[0]));
+			
+			if (!entry->data)
+			{
+				// count only covers the copies made so far
+				undo_pop(stack);
+				return false;
+			}
+			
+			memcpy(entry->data, entries[i].data, entries[i].samples * sizeof(entries[i].data[0]));
+		}
+		
+		frame->wave_batch.count = i + 1;
+	}
+	
+	return true;
+}
+
+
 void undo_store_wave_param(UndoStack *stack, int idx, const CydWavetableEntry *entry, bool modified)
 {
 	UndoEvent *frame = get_frame(UNDO_WAVE_PARAM, stack, modified);
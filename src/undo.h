@@ -39,7 +39,9 @@ typedef enum
 	UNDO_MODE,
 	UNDO_WAVE_PARAM,
 	UNDO_WAVE_DATA,
-	UNDO_WAVE_NAME
+	UNDO_WAVE_NAME,
+	UNDO_WAVE_RANGE,
+	UNDO_WAVE_BATCH
 } UndoType;
 
 typedef union
@@ -78,6 +80,14 @@ typedef union
 		int idx;
 		char *name;
 	} wave_name;
+	struct {
+		int idx, first, length;
+		Sint16 *data;
+	} wave_range;
+	struct {
+		int first, count;
+		CydWavetableEntry *entry;
+	} wave_batch;
 } UndoEvent;
 
 typedef struct UndoFrame_t
@@ -110,6 +120,10 @@ void undo_store_pattern(UndoStack *stack, int idx, const MusPattern *pattern, bo
 void undo_store_wave_data(UndoStack *stack, int idx, const CydWavetableEntry *entry, bool modified);
 void undo_store_wave_name(UndoStack *stack, int idx, const char *name, bool modified);
 void undo_store_wave_param(UndoStack *stack, int idx, const CydWavetableEntry *entry, bool modified);
+/* Stores samples first..first + length - 1 only, data is the old content of that range */
+void undo_store_wave_range(UndoStack *stack, int idx, int first, int length, const Sint16 *data, bool modified);
+/* Stores items first..first + count - 1 as one step */
+bool undo_store_wave_batch(UndoStack *stack, int first, int count, const CydWavetableEntry *entries, bool modified);
 
 #ifdef DEBUG
 void undo_show_stack(UndoStack *stack);
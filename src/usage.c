@@ -0,0 +1,255 @@
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "usage.h"
+#include "macros.h"
+#include <string.h>
+
+/* 
+Pattern refs are stored CSR-style: refs for pattern i are 
+pattern_ref[pattern_offset[i]] .. pattern_ref[pattern_offset[i + 1] - 1],
+the other offsets only give the counts
+*/
+
+typedef struct
+{
+	const MusSong *song;
+	bool dirty;
+	int num_patterns, num_instruments, num_wavetables;
+	int *pattern_offset, *instrument_offset, *wavetable_offset;
+	UsageSeqRef *pattern_ref;
+	bool *pattern_empty;
+	int *unused_pattern, num_unused_patterns;
+} UsageIndex;
+
+static UsageIndex usage = { .song = NULL, .dirty = true };
+
+
+void usage_invalidate()
+{
+	usage.dirty = true;
+}
+
+
+static int wavetable_param(Uint16 command)
+{
+	if ((command & 0x7f00) == MUS_FX_SET_WAVETABLE_ITEM)
+		return command & 0xff;
+	
+	return -1;
+}
+
+
+static bool is_step_empty(const MusStep *step)
+{
+	return step->note == MUS_NOTE_NONE
+		&& step->ctrl == 0
+		&& step->instrument == MUS_NOTE_NO_INSTRUMENT
+		&& step->command == 0;
+}
+
+
+/* Turns per-item counts (stored at offset[i + 1]) into running offsets */
+
+static void make_offsets(int *offset, int n)
+{
+	offset[0] = 0;
+	
+	for (int i = 0 ; i < n ; ++i)
+		offset[i + 1] += offset[i];
+}
+
+
+static void rebuild(const MusSong *song)
+{
+	debug("Rebuilding usage index");
+	
+	const int np = song->num_patterns, ni = song->num_instruments, nw = song->num_wavetables;
+	
+	usage.pattern_offset = realloc(usage.pattern_offset, (np + 1) * sizeof(int));
+	usage.instrument_offset = realloc(usage.instrument_offset, (ni + 1) * sizeof(int));
+	usage.wavetable_offset = realloc(usage.wavetable_offset, (nw + 1) * sizeof(int));
+	usage.pattern_empty = realloc(usage.pattern_empty, np * sizeof(bool));
+	usage.unused_pattern = realloc(usage.unused_pattern, np * sizeof(int));
+	
+	memset(usage.pattern_offset, 0, (np + 1) * sizeof(int));
+	memset(usage.instrument_offset, 0, (ni + 1) * sizeof(int));
+	memset(usage.wavetable_offset, 0, (nw + 1) * sizeof(int));
+	
+	// Count references
+	
+	int total_seq = 0;
+	
+	for (int c = 0 ; c < song->num_channels ; ++c)
+		for (int s = 0 ; s < song->num_sequences[c] ; ++s)
+			if (song->sequence[c][s].pattern < np)
+			{
+				++usage.pattern_offset[song->sequence[c][s].pattern + 1];
+				++total_seq;
+			}
+	
+	for (int p = 0 ; p < np ; ++p)
+	{
+		const MusPattern *pat = &song->pattern[p];
+		
+		usage.pattern_empty[p] = true;
+		
+		for (int i = 0 ; i < pat->num_steps ; ++i)
+		{
+			const MusStep *step = &pat->step[i];
+			const int w = wavetable_param(step->command);
+			
+			if (step->instrument < ni)
+				++usage.instrument_offset[step->instrument + 1];
+			
+			if (w >= 0 && w < nw && step->command == (MUS_FX_SET_WAVETABLE_ITEM | w))
+				++usage.wavetable_offset[w + 1];
+			
+			if (!is_step_empty(step))
+				usage.pattern_empty[p] = false;
+		}
+	}
+	
+	for (int i = 0 ; i < ni ; ++i)
+	{
+		const MusInstrument *inst = &song->instrument[i];
+		
+		if (inst->wavetable_entry < nw)
+			++usage.wavetable_offset[inst->wavetable_entry + 1];
+		
+		if (inst->fm_wave < nw)
+			++usage.wavetable_offset[inst->fm_wave + 1];
+		
+		for (int p = 0 ; p < MUS_PROG_LEN ; ++p)
+		{
+			const int w = wavetable_param(inst->program[p]);
+			
+			if (w >= 0 && w < nw)
+				++usage.wavetable_offset[w + 1];
+		}
+	}
+	
+	make_offsets(usage.pattern_offset, np);
+	make_offsets(usage.instrument_offset, ni);
+	make_offsets(usage.wavetable_offset, nw);
+	
+	// Fill the pattern refs, using a scratch copy of the offsets as write cursors
+	
+	usage.pattern_ref = realloc(usage.pattern_ref, my_max(1, total_seq) * sizeof(usage.pattern_ref[0]));
+	
+	int *cursor = malloc(my_max(1, np) * sizeof(int));
+	
+	memcpy(cursor, usage.pattern_offset, np * sizeof(int));
+	
+	for (int c = 0 ; c < song->num_channels ; ++c)
+		for (int s = 0 ; s < song->num_sequences[c] ; ++s)
+			if (song->sequence[c][s].pattern < np)
+			{
+				UsageSeqRef *ref = &usage.pattern_ref[cursor[song->sequence[c][s].pattern]++];
+				ref->channel = c;
+				ref->slot = s;
+			}
+	
+	free(cursor);
+	
+	usage.num_unused_patterns = 0;
+	
+	for (int p = 0 ; p < np ; ++p)
+		if (usage.pattern_offset[p] == usage.pattern_offset[p + 1] && usage.pattern_empty[p])
+			usage.unused_pattern[usage.num_unused_patterns++] = p;
+	
+	usage.song = song;
+	usage.num_patterns = np;
+	usage.num_instruments = ni;
+	usage.num_wavetables = nw;
+	usage.dirty = false;
+}
+
+
+static void update(const MusSong *song)
+{
+	if (usage.dirty || usage.song != song || usage.num_patterns != song->num_patterns 
+		|| usage.num_instruments != song->num_instruments || usage.num_wavetables != song->num_wavetables)
+		rebuild(song);
+}
+
+
+const UsageSeqRef * usage_pattern_refs(const MusSong *song, int pattern, int *count)
+{
+	update(song);
+	
+	if (pattern < 0 || pattern >= usage.num_patterns)
+	{
+		*count = 0;
+		return NULL;
+	}
+	
+	*count = usage.pattern_offset[pattern + 1] - usage.pattern_offset[pattern];
+	return &usage.pattern_ref[usage.pattern_offset[pattern]];
+}
+
+
+int usage_pattern_count(const MusSong *song, int pattern)
+{
+	int count;
+	usage_pattern_refs(song, pattern, &count);
+	return count;
+}
+
+
+int usage_instrument_count(const MusSong *song, int instrument)
+{
+	update(song);
+	
+	if (instrument < 0 || instrument >= usage.num_instruments)
+		return 0;
+	
+	return usage.instrument_offset[instrument + 1] - usage.instrument_offset[instrument];
+}
+
+
+int usage_wavetable_count(const MusSong *song, int wavetable)
+{
+	update(song);
+	
+	if (wavetable < 0 || wavetable >= usage.num_wavetables)
+		return 0;
+	
+	return usage.wavetable_offset[wavetable + 1] - usage.wavetable_offset[wavetable];
+}
+
+
+/* Returns the lowest empty pattern not in the sequence other than skip or -1 */
+
+int usage_find_unused_pattern(const MusSong *song, int skip)
+{
+	update(song);
+	
+	for (int i = 0 ; i < usage.num_unused_patterns && i < 2 ; ++i)
+		if (usage.unused_pattern[i] != skip)
+			return usage.unused_pattern[i];
+	
+	return -1;
+}
@@ -0,0 +1,53 @@
+#ifndef USAGE_H
+#define USAGE_H
+
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "snd/music.h"
+#include <stdbool.h>
+
+/* 
+Song-wide usage index. Reference counts for patterns, instruments and
+wavetable items and the sequence positions of each pattern are rebuilt in one
+pass over the song the first time they are queried after usage_invalidate().
+snapshot() invalidates the index so any undoable edit is picked up automatically.
+Edits that bypass snapshot() are not seen, so code that deletes data based on
+the index (the optimizer) calls usage_invalidate() before its scan.
+*/
+
+typedef struct
+{
+	Uint16 channel, slot; // song->sequence[channel][slot]
+} UsageSeqRef;
+
+void usage_invalidate();
+int usage_pattern_count(const MusSong *song, int pattern);
+int usage_instrument_count(const MusSong *song, int instrument);
+int usage_wavetable_count(const MusSong *song, int wavetable);
+const UsageSeqRef * usage_pattern_refs(const MusSong *song, int pattern, int *count);
+int usage_find_unused_pattern(const MusSong *song, int skip);
+
+#endif
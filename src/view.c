@@ -40,6 +40,7 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "edit.h"
 #include "mymsg.h"
 #include "command.h"
+#include "dspload.h"
 #include <string.h>
 
 extern Mused mused;
@@ -532,6 +533,22 @@ void info_line(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL_Event *e
 	console_clear(mused.console);
 	bevelex(domain,&area, mused.slider_bevel, BEV_THIN_FRAME, BEV_F_STRETCH_ALL);
 	adjust_rect(&area, 3);
+
+	if (mused.flags & SHOW_DSP_LOAD)
+	{
+		const DspLoad *load = dl_get();
+		char meter[50];
+		snprintf(meter, sizeof(meter), "DSP %3d%% PK %3d%% XR %u", (int)(load->load * 100), (int)(load->peak * 100), load->xruns);
+
+		SDL_Rect r;
+		copy_rect(&r, &area);
+		r.w = strlen(meter) * mused.smallfont.w;
+		r.x = area.x + area.w - r.w;
+		area.w -= r.w + mused.smallfont.w;
+
+		font_write(&mused.smallfont, domain, &r, meter);
+	}
+
 	console_set_clip(mused.console, &area);
 	console_set_color(mused.console, colors[COLOR_STATUSBAR_TEXT]);
 
@@ -2007,6 +2024,10 @@ void sequence_spectrum_view(GfxDomain *dest_surface, const SDL_Rect *dest, const
 			case VIS_CATOMETER:
 				catometer_view(dest_surface, &a, event, param);
 				break;
+
+			case VIS_OSCILLOSCOPE:
+				oscilloscope_view(dest_surface, &a, event, param);
+				break;
 		}
 
 		gfx_domain_set_clip(domain, NULL);
@@ -2054,3 +2075,43 @@ void toolbar_view(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL_Event
 
 	button.x += button.w;
 }
+
+
+bool progress_box(const char *message, int done, int total)
+{
+	SDL_Rect area = {domain->screen_w / 2 - 140, domain->screen_h / 2 - 24, 280, 48};
+	bevel(domain, &area, mused.slider_bevel, BEV_MENU);
+
+	adjust_rect(&area, 8);
+	area.h = 16;
+
+	bevel(domain, &area, mused.slider_bevel, BEV_FIELD);
+
+	adjust_rect(&area, 2);
+
+	int t = area.w;
+
+	if (total > 0)
+		area.w = area.w * done / total;
+
+	gfx_rect(domain, &area, colors[COLOR_PROGRESS_BAR]);
+
+	area.y += 16 + 4 + 4;
+	area.w = t;
+
+	font_write_args(&mused.smallfont, domain, &area, "%s Press ESC to abort.", message);
+
+	SDL_Event e;
+
+	while (SDL_PollEvent(&e))
+	{
+		if (e.type == SDL_QUIT || (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_ESCAPE))
+		{
+			return false;
+		}
+	}
+
+	gfx_domain_flip(domain);
+
+	return true;
+}
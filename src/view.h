@@ -75,5 +75,7 @@ void toolbar_view(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL_Event
 void fx_global_view(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL_Event *event, void *param);
 void label(const char *_label, const SDL_Rect *area);
 void inst_field(const SDL_Event *e, const SDL_Rect *area, int p, int length, char *text);
+/* Draws a progress bar over everything, returns false if the user wants to abort */
+bool progress_box(const char *message, int done, int total);
 
 #endif
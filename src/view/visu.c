@@ -30,9 +30,116 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "snd/freqs.h"
 #include "gfx/gfx.h"
 #include "theme.h"
+#include "dspload.h"
+#include "wavefilter.h"
+#include <math.h>
 
 extern Uint32 colors[NUM_COLORS];
 
+#define SPEC_FFT_SIZE 4096 // ~11 Hz bins at 44.1 kHz
+#define SPEC_FLOOR -60.0f // dB, shown as an empty bar
+#define SPEC_BARS 96
+#define SCOPE_SIZE 1024 // samples read from the output ring
+#define SCOPE_SPAN 512 // samples shown in the scope
+
+static float spec_window[SPEC_FFT_SIZE], spec_twr[SPEC_FFT_SIZE / 2], spec_twi[SPEC_FFT_SIZE / 2];
+
+
+/*
+Power spectrum of SPEC_FFT_SIZE real samples. The even samples go in the
+real part and the odd samples in the imaginary part of a half size complex
+FFT, the two interleaved spectra are then separated with one more pass.
+*/
+
+static void real_fft_power(const float *x, float *power)
+{
+	static float re[SPEC_FFT_SIZE / 2], im[SPEC_FFT_SIZE / 2];
+	static bool initialized = false;
+	const int m = SPEC_FFT_SIZE / 2;
+	
+	if (!initialized)
+	{
+		for (int i = 0 ; i < SPEC_FFT_SIZE ; ++i)
+			spec_window[i] = 0.5 - 0.5 * cos(2 * M_PI * i / SPEC_FFT_SIZE);
+		
+		for (int k = 0 ; k < m ; ++k)
+		{
+			spec_twr[k] = cos(2 * M_PI * k / SPEC_FFT_SIZE);
+			spec_twi[k] = -sin(2 * M_PI * k / SPEC_FFT_SIZE);
+		}
+		
+		initialized = true;
+	}
+	
+	for (int k = 0 ; k < m ; ++k)
+	{
+		re[k] = x[2 * k] * spec_window[2 * k];
+		im[k] = x[2 * k + 1] * spec_window[2 * k + 1];
+	}
+	
+	wf_fft(re, im, m, false);
+	
+	for (int k = 0 ; k < m ; ++k)
+	{
+		const int j = (m - k) & (m - 1);
+		
+		// Even part is (Z[k] + Z*[m-k]) / 2, odd part is (Z[k] - Z*[m-k]) / 2i
+		
+		const float er = (re[k] + re[j]) * 0.5f, ei = (im[k] - im[j]) * 0.5f;
+		const float odr = (im[k] + im[j]) * 0.5f, odi = (re[j] - re[k]) * 0.5f;
+		const float xr = er + spec_twr[k] * odr - spec_twi[k] * odi;
+		const float xi = ei + spec_twr[k] * odi + spec_twi[k] * odr;
+		
+		power[k] = xr * xr + xi * xi;
+	}
+}
+
+
+static void calculate_spectrum(int *spec)
+{
+	static float samples[SPEC_FFT_SIZE], power[SPEC_FFT_SIZE / 2];
+	const int sample_rate = dl_get()->sample_rate;
+	
+	if (sample_rate == 0)
+		return;
+	
+	ar_read(&mused.output_ring, samples, SPEC_FFT_SIZE);
+	real_fft_power(samples, power);
+	
+	// A full scale sine peaks at N/2 times the Hann window gain of 1/2
+	
+	const float ref = (float)SPEC_FFT_SIZE * SPEC_FFT_SIZE / 16;
+	const float bins_per_hz = (float)SPEC_FFT_SIZE / sample_rate;
+	
+	for (int i = 0 ; i < SPEC_BARS ; ++i)
+	{
+		// Each bar covers one semitone, the low ones are narrower than a bin
+		
+		const float lo = 440.0 * pow(2.0, (i - 0.5 - (MIDDLE_C + 9)) / 12.0) * bins_per_hz;
+		const float hi = 440.0 * pow(2.0, (i + 0.5 - (MIDDLE_C + 9)) / 12.0) * bins_per_hz;
+		float p = 0;
+		
+		if (lo >= SPEC_FFT_SIZE / 2 - 1)
+			break;
+		
+		if ((int)hi > (int)lo)
+		{
+			for (int b = (int)lo + 1 ; b <= (int)hi && b < SPEC_FFT_SIZE / 2 ; ++b)
+				p = my_max(p, power[b]);
+		}
+		else
+		{
+			const float c = (lo + hi) / 2;
+			const int b = c;
+			p = power[b] + (power[b + 1] - power[b]) * (c - b);
+		}
+		
+		const float db = p > 0 ? 10 * log10(p / ref) : SPEC_FLOOR;
+		spec[i] = my_max(0, my_min(MAX_VOLUME, (db - SPEC_FLOOR) * MAX_VOLUME / -SPEC_FLOOR));
+	}
+}
+
+
 void spectrum_analyzer_view(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL_Event *event, void *param)
 {
 	SDL_Rect content;
@@ -42,17 +149,11 @@ void spectrum_analyzer_view(GfxDomain *dest_surface, const SDL_Rect *dest, const
 	gfx_domain_get_clip(domain, &clip);
 	gfx_domain_set_clip(domain, &content);
 	
-	int spec[255] = { 0 };
+	int spec[SPEC_BARS] = { 0 };
 	
-	for (int i = 0 ; i < MUS_MAX_CHANNELS ; ++i)
-	{
-		Uint8 note = (mused.stat_note[i] & 0xff00) >> 8;
-		spec[note] = my_max(spec[note], mused.vis.cyd_env[i]);
-		if (note > 0) spec[note - 1] = my_max(spec[note] / 3, spec[note - 1]);
-		if (note < 255) spec[note + 1] = my_max(spec[note] / 3, spec[note + 1]);
-	}
+	calculate_spectrum(spec);
 	
-	for (int i = 0 ; i < 96 ; ++i)
+	for (int i = 0 ; i < SPEC_BARS ; ++i)
 	{
 		if (spec[i] >= mused.vis.spec_peak[i])
 			mused.vis.spec_peak_decay[i] = 0;
@@ -64,7 +165,7 @@ void spectrum_analyzer_view(GfxDomain *dest_surface, const SDL_Rect *dest, const
 	SDL_Rect bar = {content.x, 0, w, 0};
 	SDL_Rect src = { 0, 0, w, content.h };
 	
-	for (int i = (MIDDLE_C - content.w / w / 2 + 12) ; i < FREQ_TAB_SIZE && bar.x < content.x + content.w ; ++i, bar.x += bar.w)
+	for (int i = (MIDDLE_C - content.w / w / 2 + 12) ; i < SPEC_BARS && bar.x < content.x + content.w ; ++i, bar.x += bar.w)
 	{
 		if (i >= 0)
 		{
@@ -151,3 +252,59 @@ void catometer_view(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL_Eve
 	
 	gfx_domain_set_clip(dest_surface, &clip);
 }
+
+
+/* Latest rising zero crossing that still leaves SCOPE_SPAN samples after it */
+
+static int scope_trigger(const float *data, int length)
+{
+	for (int i = length - SCOPE_SPAN ; i > 0 ; --i)
+	{
+		if (data[i - 1] < 0 && data[i] >= 0)
+			return i;
+	}
+	
+	return length - SCOPE_SPAN;
+}
+
+
+static void draw_scope(GfxDomain *dest_surface, SDL_Rect *area, const float *data, int length, Uint32 color)
+{
+	gfx_rect(dest_surface, area, colors[COLOR_WAVETABLE_BACKGROUND]);
+	
+	const float *span = &data[scope_trigger(data, length)];
+	const int mid = area->y + area->h / 2;
+	int prev_y = mid;
+	
+	for (int x = 0 ; x < area->w ; ++x)
+	{
+		const float v = my_max(-1.0f, my_min(1.0f, span[x * SCOPE_SPAN / area->w]));
+		const int y = mid - v * (area->h / 2 - 1);
+		
+		if (x > 0)
+			gfx_line(dest_surface, area->x + x - 1, prev_y, area->x + x, y, color);
+		
+		prev_y = y;
+	}
+}
+
+
+/* Mixed output only, the mixer has no per-channel tap to read from */
+void oscilloscope_view(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL_Event *event, void *param)
+{
+	SDL_Rect content;
+	copy_rect(&content, dest);
+	
+	gfx_rect(dest_surface, &content, colors[COLOR_BACKGROUND]);
+	
+	SDL_Rect clip;
+	gfx_domain_get_clip(domain, &clip);
+	gfx_domain_set_clip(domain, &content);
+	
+	float data[SCOPE_SIZE];
+	
+	ar_read(&mused.output_ring, data, SCOPE_SIZE);
+	draw_scope(dest_surface, &content, data, SCOPE_SIZE, colors[COLOR_WAVETABLE_SAMPLE]);
+	
+	gfx_domain_set_clip(dest_surface, &clip);
+}
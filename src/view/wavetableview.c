@@ -32,6 +32,9 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "gui/bevel.h"
 #include "theme.h"
 #include "mybevdefs.h"
+#include <math.h>
+#include "snd/freqs.h"
+#include "wavepeaks.h"
 #include "action.h"
 #include "wave_action.h"
 
@@ -174,44 +177,81 @@ void wavetablelist_view(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL
 }
 
 
+/* Peak pyramids for the items that have been displayed, see wavepeaks.h */
+
+static WavePeaks wave_peaks[CYD_WAVE_MAX_ENTRIES];
+
+
+static void get_sample_view_range(const CydWavetableEntry *w, int *start, int *length)
+{
+	static int zoomed_wave = -1;
+	
+	if (zoomed_wave != mused.selected_wavetable)
+	{
+		zoomed_wave = mused.selected_wavetable;
+		mused.wavetable_view_length = 0;
+	}
+	
+	if (mused.wavetable_view_length <= 0 || mused.wavetable_view_length >= w->samples)
+	{
+		mused.wavetable_view_start = 0;
+		mused.wavetable_view_length = 0;
+		*start = 0;
+		*length = w->samples;
+	}
+	else
+	{
+		mused.wavetable_view_start = my_max(0, my_min(w->samples - mused.wavetable_view_length, mused.wavetable_view_start));
+		*start = mused.wavetable_view_start;
+		*length = mused.wavetable_view_length;
+	}
+}
+
+
 static void update_sample_preview(GfxDomain *dest, const SDL_Rect* area)
 {
+	static int prev_start = -1, prev_length = -1;
+	
+	const CydWavetableEntry *w = &mused.mus.cyd->wavetable_entries[mused.selected_wavetable];
+	WavePeaks *peaks = &wave_peaks[mused.selected_wavetable];
+	
+	const bool changed = peaks->data != w->data || peaks->samples != w->samples;
+	
+	if (!wp_sync(peaks, w->data, w->samples))
+		warning("Out of memory for wave display");
+	
+	int start, length;
+	get_sample_view_range(w, &start, &length);
+	
 	if (!mused.wavetable_preview || (mused.wavetable_preview->surface->w != area->w || mused.wavetable_preview->surface->h != area->h))
 	{
 		if (mused.wavetable_preview) gfx_free_surface(mused.wavetable_preview);
 		
 		mused.wavetable_preview = gfx_create_surface(dest, area->w, area->h);	
 	}
-	else if (mused.wavetable_preview_idx == mused.selected_wavetable) return;
+	else if (mused.wavetable_preview_idx == mused.selected_wavetable && !changed && start == prev_start && length == prev_length) return;
 	
 	mused.wavetable_preview_idx = mused.selected_wavetable;
+	prev_start = start;
+	prev_length = length;
 	
 	SDL_FillRect(mused.wavetable_preview->surface, NULL, SDL_MapRGB(mused.wavetable_preview->surface->format, (colors[COLOR_WAVETABLE_BACKGROUND] >> 16) & 255, (colors[COLOR_WAVETABLE_BACKGROUND] >> 8) & 255, colors[COLOR_WAVETABLE_BACKGROUND] & 255));
 
-	const CydWavetableEntry *w = &mused.mus.cyd->wavetable_entries[mused.selected_wavetable];
-	
 	mused.wavetable_bits = 0;
 	
-	if (w->samples > 0)
+	if (w->samples > 0 && peaks->data)
 	{
-		const int res = 4096;
-		const int dadd = my_max(res, w->samples * res / area->w);
-		const int gadd = my_max(res, (Uint32)area->w * res / w->samples);
-		int c = 0, d = 0;
-				
-		for (int x = 0 ; x < area->w * res ; )
+		const Uint32 color = SDL_MapRGB(mused.wavetable_preview->surface->format, (colors[COLOR_WAVETABLE_SAMPLE] >> 16) & 255, (colors[COLOR_WAVETABLE_SAMPLE] >> 8) & 255, colors[COLOR_WAVETABLE_SAMPLE] & 255);
+		int min, max;
+		
+		wp_query(peaks, 0, w->samples, &min, &max, &mused.wavetable_bits);
+		
+		for (int x = 0 ; x < area->w ; ++x)
 		{
-			int min = 32768;
-			int max = -32768;
+			const int first = start + (Sint64)x * length / area->w;
+			const int last = my_max(first + 1, start + (Sint64)(x + 1) * length / area->w);
 			
-			for (; d < w->samples && c < dadd ; c += res, ++d)
-			{
-				min = my_min(min, w->data[d]);
-				max = my_max(max, w->data[d]);
-				mused.wavetable_bits |= w->data[d];
-			}
-			
-			c -= dadd;
+			wp_query(peaks, first, last, &min, &max, NULL);
 			
 			if (min < 0 && max < 0)
 				max = 0;
@@ -221,13 +261,10 @@ static void update_sample_preview(GfxDomain *dest, const SDL_Rect* area)
 			
 			min = (32768 + min) * area->h / 65536;
 			max = (32768 + max) * area->h / 65536 - min;
-		
-			int prev_x = x - 1;
-			x += gadd;
 			
-			SDL_Rect r = { prev_x / res, min, my_max(1, x / res - prev_x / res), max + 1 };
+			SDL_Rect r = { x, min, 1, max + 1 };
 			
-			SDL_FillRect(mused.wavetable_preview->surface, &r, SDL_MapRGB(mused.wavetable_preview->surface->format, (colors[COLOR_WAVETABLE_SAMPLE] >> 16) & 255, (colors[COLOR_WAVETABLE_SAMPLE] >> 8) & 255, colors[COLOR_WAVETABLE_SAMPLE] & 255));
+			SDL_FillRect(mused.wavetable_preview->surface, &r, color);
 		}
 		
 		debug("Wavetable item bitmask = %x, lowest bit = %d", mused.wavetable_bits, __builtin_ffs(mused.wavetable_bits) - 1);
@@ -239,6 +276,17 @@ static void update_sample_preview(GfxDomain *dest, const SDL_Rect* area)
 }
 
 
+/* Screen x to position relative to the whole sample */
+
+static float view_to_sample(const CydWavetableEntry *w, const SDL_Rect *area, int view_start, int view_length, int x)
+{
+	if (w->samples <= 0)
+		return 0;
+	
+	return (view_start + (float)(x - area->x) / area->w * view_length) / w->samples;
+}
+
+
 void wavetable_sample_view(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL_Event *event, void *param)
 {
 	SDL_Rect area;
@@ -248,8 +296,39 @@ void wavetable_sample_view(GfxDomain *dest_surface, const SDL_Rect *dest, const
 	update_sample_preview(dest_surface, &area);
 	my_BlitSurface(mused.wavetable_preview, NULL, dest_surface, &area);
 	
+	const CydWavetableEntry *w = &mused.mus.cyd->wavetable_entries[mused.selected_wavetable];
+	int view_start, view_length;
+	get_sample_view_range(w, &view_start, &view_length);
+	
 	int mx, my;
 	
+	if (event->type == SDL_MOUSEWHEEL && w->samples > 0)
+	{
+		SDL_GetMouseState(&mx, &my);
+		mx /= mused.pixel_scale;
+		my /= mused.pixel_scale;
+		
+		if (mx >= area.x && my >= area.y && mx < area.x + area.w && my < area.y + area.h)
+		{
+			if (SDL_GetModState() & KMOD_SHIFT)
+			{
+				// Scroll by an eighth of the view
+				mused.wavetable_view_start = view_start + (event->wheel.y > 0 ? -1 : 1) * my_max(1, view_length / 8);
+			}
+			else
+			{
+				// Zoom by two around the sample under the mouse
+				const Sint64 pivot = view_start + (Sint64)(mx - area.x) * view_length / area.w;
+				const int new_length = event->wheel.y > 0 ? my_max(my_min(16, w->samples), view_length / 2) : my_min(w->samples, view_length * 2);
+				
+				mused.wavetable_view_start = pivot - (pivot - view_start) * new_length / view_length;
+				mused.wavetable_view_length = new_length;
+			}
+			
+			get_sample_view_range(w, &view_start, &view_length);
+		}
+	}
+	
 	if (mused.mode == EDITWAVETABLE && (SDL_GetMouseState(&mx, &my) & SDL_BUTTON(1)))
 	{
 		mx /= mused.pixel_scale;
@@ -269,25 +348,33 @@ void wavetable_sample_view(GfxDomain *dest_surface, const SDL_Rect *dest, const
 		else
 			dx = -1;
 		
+		// Pencil positions are relative to the whole sample
+		
+		const float view_w = w->samples > 0 ? (float)view_length / area.w / w->samples : 0;
+		
 		if (mx >= area.x && my >= area.y
 			&& mx < area.x + area.w && my < area.y + area.h)
 		{
 			if (d > 0)
 			{
 				for (int x = mx, i = 0 ; i <= d ; x += dx, ++i)
-					wavetable_draw((float)(x - area.x) / area.w, (float)((my + (mused.prev_wavetable_y - my) * i / d) - area.y) / area.h, 1.0f / area.w);
+					wavetable_draw(view_to_sample(w, &area, view_start, view_length, x), (float)((my + (mused.prev_wavetable_y - my) * i / d) - area.y) / area.h, view_w);
 			}
 			else
-				wavetable_draw((float)(mx - area.x) / area.w, (float)(my - area.y) / area.h, 1.0f / area.w);
+				wavetable_draw(view_to_sample(w, &area, view_start, view_length, mx), (float)(my - area.y) / area.h, view_w);
 		}
 		
 		mused.prev_wavetable_x = mx;
 		mused.prev_wavetable_y = my;
+		
+		wavetable_draw_flush();
 	}
 	else
 	{
 		mused.prev_wavetable_x = -1;
 		mused.prev_wavetable_y = -1;
+		
+		wavetable_draw_end();
 	}
 }
 
@@ -296,6 +383,30 @@ void invalidate_wavetable_view()
 {
 	mused.wavetable_preview_idx = -1;
 	mused.wavetable_bits = 0;
+	wp_invalidate(&wave_peaks[mused.selected_wavetable]);
+}
+
+
+void invalidate_wavetable_range(int first, int last)
+{
+	mused.wavetable_preview_idx = -1;
+	wp_update(&wave_peaks[mused.selected_wavetable], first, last);
+}
+
+
+void invalidate_wavetable_items(int first, int count)
+{
+	for (int i = first ; i < first + count && i < CYD_WAVE_MAX_ENTRIES ; ++i)
+		wp_invalidate(&wave_peaks[i]);
+	
+	invalidate_wavetable_view();
+}
+
+
+void free_wavetable_peaks()
+{
+	for (int i = 0 ; i < CYD_WAVE_MAX_ENTRIES ; ++i)
+		wp_free(&wave_peaks[i]);
 }
 
 
@@ -392,21 +503,121 @@ void wavetable_tools_view(GfxDomain *dest_surface, const SDL_Rect *dest, const S
 	}
 	
 	{
+		int d;
+		char temp[16];
+		WfSettings *wf = &mused.wfset;
+		
+		r.y += 2;
+		
+		if ((d = generic_field(event, &r, EDITWAVETABLE, -1, "FILTER", "%s", (char*)wf_type_name[wf->type], 8)) != 0)
+		{
+			wf->type = my_max(0, my_min(WF_NUM_TYPES - 1, (int)wf->type + d));
+		}
+		
+		r.y += r.h;
+		
+		if ((d = generic_field(event, &r, EDITWAVETABLE, -1, "CUTOFF", "%d", MAKEPTR(wf->cutoff), 5)) != 0)
+		{
+			// One semitone per step
+			wf->cutoff = my_max(10, my_min(96000, (int)(wf->cutoff * pow(2.0, d / 12.0) + (d > 0 ? 0.5 : 0))));
+		}
+		
+		r.y += r.h;
+		
+		if (wf_is_fir(wf->type))
+		{
+			if ((d = generic_field(event, &r, EDITWAVETABLE, -1, "TAPS", "%d", MAKEPTR(wf->taps), 5)) != 0)
+			{
+				wf->taps = my_max(WF_MIN_TAPS, my_min(WF_MAX_TAPS, wf->taps + d * 2));
+			}
+		}
+		else
+		{
+			snprintf(temp, sizeof(temp), "%d.%02d", wf->q / 100, wf->q % 100);
+			
+			if ((d = generic_field(event, &r, EDITWAVETABLE, -1, "Q", "%s", temp, 5)) != 0)
+			{
+				wf->q = my_max(10, my_min(2000, wf->q + d * 5));
+			}
+		}
+		
+		r.y += r.h;
+		
+		if ((d = generic_field(event, &r, EDITWAVETABLE, -1, "GAIN DB", "%+d", MAKEPTR(wf->gain), 5)) != 0)
+		{
+			wf->gain = my_max(-24, my_min(24, wf->gain + d));
+		}
+		
+		r.y += r.h;
+		
+		button_text_event(domain, event, &r, mused.slider_bevel, &mused.buttonfont, BEV_BUTTON, BEV_BUTTON_ACTIVE, "APPLY FILTER", wavetable_filter, wf, NULL, NULL);
+		
+		r.y += r.h + 2;
+	}
+	
+	{
+		int d;
+		WrSettings *wr = &mused.wrset;
+		
+		if ((d = generic_field(event, &r, EDITWAVETABLE, -1, "RATE", "%d", MAKEPTR(wr->rate), 6)) != 0)
+		{
+			wr->rate = my_max(1000, my_min(192000, wr->rate + d * 50));
+		}
+		
+		r.y += r.h;
+		
+		if ((d = generic_field(event, &r, EDITWAVETABLE, -1, "TRANSP", "%+d", MAKEPTR(wr->transpose), 4)) != 0)
+		{
+			wr->transpose = my_max(-48, my_min(48, wr->transpose + d));
+		}
+		
+		r.y += r.h;
+		
+		if ((d = generic_field(event, &r, EDITWAVETABLE, -1, "SINC", "%d", MAKEPTR(wr->taps), 4)) != 0)
+		{
+			wr->taps = my_max(WR_MIN_TAPS, my_min(WR_MAX_TAPS, wr->taps + d * 2));
+		}
+		
+		r.y += r.h;
+		
+		button_text_event(domain, event, &r, mused.slider_bevel, &mused.buttonfont, BEV_BUTTON, BEV_BUTTON_ACTIVE, "RESAMPLE", wavetable_resample, wr, NULL, NULL);
+		
+		r.y += r.h + 2;
+	}
+	
+	{
+		int d;
+		WbSettings *wb = &mused.wbset;
+		
+		if ((d = generic_field(event, &r, EDITWAVETABLE, -1, "BATCH TO", "%02X", MAKEPTR(wb->last), 2)) != 0)
+		{
+			wb->last = my_max(0, my_min(CYD_WAVE_MAX_ENTRIES - 1, wb->last + d));
+		}
+		
+		r.y += r.h;
+		
 		int temp_x = r.x;
 		int temp = r.w;
 		
 		r.w /= 2;
 		
-		button_text_event(domain, event, &r, mused.slider_bevel, &mused.buttonfont, BEV_BUTTON, BEV_BUTTON_ACTIVE, "LOPASS", wavetable_filter, MAKEPTR(0), NULL, NULL);
-		
+		generic_flags(event, &r, EDITWAVETABLE, -1, "RATE", &wb->ops, WB_RESAMPLE);
 		r.x += r.w;
-		
-		button_text_event(domain, event, &r, mused.slider_bevel, &mused.buttonfont, BEV_BUTTON, BEV_BUTTON_ACTIVE, "HIPASS", wavetable_filter, MAKEPTR(1), NULL, NULL);
-		
+		generic_flags(event, &r, EDITWAVETABLE, -1, "DC", &wb->ops, WB_REMOVE_DC);
+		r.x = temp_x;
 		r.y += r.h;
 		
+		generic_flags(event, &r, EDITWAVETABLE, -1, "FILTER", &wb->ops, WB_FILTER);
+		r.x += r.w;
+		generic_flags(event, &r, EDITWAVETABLE, -1, "NORM", &wb->ops, WB_NORMALIZE);
 		r.x = temp_x;
+		r.y += r.h;
+		
 		r.w = temp;
+		
+		button_text_event(domain, event, &r, mused.slider_bevel, &mused.buttonfont, BEV_BUTTON, BEV_BUTTON_ACTIVE, "BATCH PROCESS", wavetable_batch_process, wb, NULL, NULL);
+		
+		r.y += r.h + 2;
 	}
 	
 	button_text_event(domain, event, &r, mused.slider_bevel, &mused.buttonfont, BEV_BUTTON, BEV_BUTTON_ACTIVE, "5TH", wavetable_chord, MAKEPTR(5), NULL, NULL);
@@ -426,6 +637,100 @@ void wavetable_tools_view(GfxDomain *dest_surface, const SDL_Rect *dest, const S
 }
 
 
+/* Oscillator and chain previews are only redrawn when the parameters or the size change */
+
+typedef struct
+{
+	GfxSurface *surface;
+	Uint32 hash;
+} WaveCache;
+
+static WaveCache osc_preview[WG_CHAIN_OSCS], chain_preview;
+
+
+static void update_wavegen_preview(GfxDomain *dest, WaveCache *cache, const SDL_Rect *area, WgOsc *chain, int num_oscs)
+{
+	// Colors are part of the key so that theme changes show up
+	
+	const Uint32 hash = wg_hash(chain, num_oscs) ^ (num_oscs * 0x9e3779b9u) ^ colors[COLOR_WAVETABLE_SAMPLE] ^ (colors[COLOR_WAVETABLE_BACKGROUND] << 7);
+	
+	if (!cache->surface || (cache->surface->surface->w != area->w || cache->surface->surface->h != area->h))
+	{
+		if (cache->surface) gfx_free_surface(cache->surface);
+		
+		cache->surface = gfx_create_surface(dest, area->w, area->h);
+	}
+	else if (cache->hash == hash) return;
+	
+	cache->hash = hash;
+	
+	SDL_Surface *surface = cache->surface->surface;
+	
+	SDL_FillRect(surface, NULL, SDL_MapRGB(surface->format, (colors[COLOR_WAVETABLE_BACKGROUND] >> 16) & 255, (colors[COLOR_WAVETABLE_BACKGROUND] >> 8) & 255, colors[COLOR_WAVETABLE_BACKGROUND] & 255));
+	
+	if (area->w > 0)
+	{
+		const Uint32 color = SDL_MapRGB(surface->format, (colors[COLOR_WAVETABLE_SAMPLE] >> 16) & 255, (colors[COLOR_WAVETABLE_SAMPLE] >> 8) & 255, colors[COLOR_WAVETABLE_SAMPLE] & 255);
+		
+		WgKernel kernel;
+		wg_compile(&kernel, chain, num_oscs);
+		
+		float *y = malloc(sizeof(float) * area->w);
+		
+		if (!y)
+		{
+			// Show just the background, the mismatching hash retries next frame
+			cache->hash = ~hash;
+			return;
+		}
+		
+		if (num_oscs == 1)
+			wg_render_osc(&kernel.osc[0], 0, area->w, area->w, y);
+		else
+			wg_render(&kernel, 0, area->w, area->w, y);
+		
+		int prev = -1;
+		
+		for (int x = 0 ; x < area->w ; ++x)
+		{
+			const float v = my_max(-1.0f, my_min(1.0f, y[x]));
+			const int py = my_min(area->h - 1, (int)(v * area->h / 2 + area->h / 2));
+			
+			if (prev == -1)
+				prev = py;
+			
+			// A vertical span from the previous column keeps steep edges connected
+			
+			SDL_Rect r = { x, my_min(prev, py), 1, abs(py - prev) + 1 };
+			SDL_FillRect(surface, &r, color);
+			
+			prev = py;
+		}
+		
+		free(y);
+	}
+	
+	gfx_update_texture(dest, cache->surface);
+}
+
+
+void free_wavegen_previews()
+{
+	for (int i = 0 ; i < WG_CHAIN_OSCS ; ++i)
+	{
+		if (osc_preview[i].surface)
+			gfx_free_surface(osc_preview[i].surface);
+		
+		osc_preview[i].surface = NULL;
+	}
+	
+	if (chain_preview.surface)
+		gfx_free_surface(chain_preview.surface);
+	
+	chain_preview.surface = NULL;
+}
+
+
 void oscillator_view(GfxDomain *domain, const SDL_Rect *dest, const SDL_Event *event, void *param)
 {
 	WgOsc *osc = param;
@@ -443,16 +748,10 @@ void oscillator_view(GfxDomain *domain, const SDL_Rect *dest, const SDL_Event *e
 	
 	gfx_rect(domain, &frame, colors[COLOR_WAVETABLE_BACKGROUND]);
 	
-	wg_init_osc(osc);
-	
-	float py = wg_osc(osc, 0);
+	WaveCache *cache = &osc_preview[(osc - mused.wgset.chain) % WG_CHAIN_OSCS];
 	
-	for (int x = 1 ; x < frame.w ; ++x)
-	{
-		float y = wg_osc(osc, (float)x / frame.w);
-		gfx_line(domain, frame.x + x - 1, py * frame.h / 2 + frame.y + frame.h / 2, frame.x + x, y * frame.h / 2 + frame.y + frame.h / 2, colors[COLOR_WAVETABLE_SAMPLE]);
-		py = y;
-	}
+	update_wavegen_preview(domain, cache, &frame, osc, 1);
+	my_BlitSurface(cache->surface, NULL, domain, &frame);
 }
 
 
@@ -625,6 +924,30 @@ void wavegen_view(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL_Event
 		wave_add_param(d);
 	}
 	
+	r.y += r.h;
+	
+	if ((d = generic_field(event, &r, EDITWAVETABLE, -1, "BANDLIMIT", "%s", mused.wgset.band_limit ? "ON" : "OFF", 3)) != 0)
+	{
+		mused.wgset.band_limit = d > 0;
+	}
+	
+	if (mused.wgset.band_limit)
+	{
+		r.y += r.h;
+		
+		if ((d = generic_field(event, &r, EDITWAVETABLE, -1, "TOP NOTE", "%s", notename(mused.wgset.top_note), 3)) != 0)
+		{
+			mused.wgset.top_note = my_max(0, my_min(FREQ_TAB_SIZE - 1, mused.wgset.top_note + d));
+		}
+		
+		r.y += r.h;
+		
+		if ((d = generic_field(event, &r, EDITWAVETABLE, -1, "MIPS", "%d", MAKEPTR(mused.wgset.mips), 3)) != 0)
+		{
+			mused.wgset.mips = my_max(1, my_min(WG_MAX_MIPS, mused.wgset.mips + d));
+		}
+	}
+	
 	r.y += r.h + 2;
 	r.w = r.w / 2;
 	
@@ -670,25 +993,8 @@ void wavegen_preview(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL_Ev
 	bevelex(domain, &area, mused.slider_bevel, BEV_THIN_FRAME, BEV_F_STRETCH_ALL);
 	adjust_rect(&area, 3);
 	
-	float py = wg_get_sample(mused.wgset.chain, mused.wgset.num_oscs, 0);
-	
-	if (py > 1.0)
-		py = 1.0;
-	else if (py < -1.0)
-		py = -1.0;
-	
-	for (int x = 1 ; x < area.w ; ++x)
-	{
-		float y = wg_get_sample(mused.wgset.chain, mused.wgset.num_oscs, (float)x / area.w);
-		
-		if (y > 1.0)
-			y = 1.0;
-		else if (y < -1.0)
-			y = -1.0;
-		
-		gfx_line(domain, area.x + x - 1, py * area.h / 2 + area.y + area.h / 2, area.x + x, y * area.h / 2 + area.y + area.h / 2, colors[COLOR_WAVETABLE_SAMPLE]);
-		py = y;
-	}
+	update_wavegen_preview(dest_surface, &chain_preview, &area, mused.wgset.chain, mused.wgset.num_oscs);
+	my_BlitSurface(chain_preview.surface, NULL, dest_surface, &area);
 }
 
 
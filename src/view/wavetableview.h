@@ -37,5 +37,10 @@ void wavetable_edit_area(GfxDomain *dest_surface, const SDL_Rect *dest, const SD
 void wavetable_sample_area(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL_Event *event, void *param);
 void wavetable_name_view(GfxDomain *dest_surface, const SDL_Rect *dest, const SDL_Event *event, void *param);
 void invalidate_wavetable_view();
+void invalidate_wavetable_range(int first, int last);
+/* For items other than the selected one that got new data */
+void invalidate_wavetable_items(int first, int count);
+void free_wavetable_peaks();
+void free_wavegen_previews();
 
 #endif
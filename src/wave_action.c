@@ -5,6 +5,11 @@
 #include <string.h>
 #include "wavegen.h"
 #include "util/rnd.h"
+#include "wavekernel.h"
+#include "wavefilter.h"
+#include "waveresample.h"
+#include "wavebatch.h"
+#include "view.h"
 
 void wavetable_drop_lowest_bit(void *unused1, void *unused2, void *unused3)
 {
@@ -22,12 +27,7 @@ void wavetable_drop_lowest_bit(void *unused1, void *unused2, void *unused3)
 	
 	if (w->samples > 0)
 	{
-		int d = 0;
-				
-		for (; d < w->samples ; ++d)
-		{
-			w->data[d] &= mask;
-		}
+		wk_mask(w->data, w->samples, mask);
 		
 		invalidate_wavetable_view();
 	}
@@ -41,14 +41,7 @@ void wavetable_halve_samplerate(void *unused1, void *unused2, void *unused3)
 	
 	if (w->samples > 0)
 	{
-		int s = 0, d = 0;
-				
-		for (; s < (w->samples & (~1)) ; s += 2, ++d)
-		{
-			w->data[d] = (w->data[s] + w->data[s + 1]) / 2;
-		}
-		
-		w->samples /= 2;
+		w->samples = wk_decimate2(w->data, w->data, w->samples);
 		w->sample_rate /= 2;
 		w->loop_begin /= 2; 
 		w->loop_end /= 2;
@@ -66,22 +59,7 @@ void wavetable_normalize(void *vol, void *unused2, void *unused3)
 	
 	if (w->samples > 0)
 	{
-		int m = 0;
-				
-		for (int s = 0 ; s < w->samples ; ++s)
-		{
-			m = my_max(m, abs(w->data[s]));
-		}
-		
-		debug("Peak = %d", m);
-		
-		if (m != 0)
-		{
-			for (int s = 0 ; s < w->samples ; ++s)
-			{
-				w->data[s] = my_max(my_min((Sint32)w->data[s] * CASTPTR(int, vol) / m, 32767), -32768);
-			}
-		}
+		wb_normalize(w, CASTPTR(int, vol));
 		
 		invalidate_wavetable_view();
 	}
@@ -96,26 +74,7 @@ void wavetable_remove_dc(void *unused1, void *unused2, void *unused3)
 	
 	if (w->samples > 0)
 	{
-		double avg = 0;
-	
-		for (int s = 0 ; s < w->samples ; ++s)
-		{
-			avg += w->data[s];
-		}
-		
-		avg /= w->samples;
-		
-		for (int s = 0 ; s < w->samples ; ++s)
-		{
-			double new_val = w->data[s] - avg;
-			
-			if (new_val < -32768)
-				new_val = -32768;
-			else if (new_val > 32767)
-				new_val = 32767;
-				
-			w->data[s] = new_val;
-		}
+		wb_remove_dc(w);
 		
 		invalidate_wavetable_view();
 	}
@@ -218,11 +177,16 @@ void wavetable_chord(void *transpose, void *unused2, void *unused3)
 					new_data[s] = ((int)w->data[s % w->samples] + (int)w->data[(s * denom / nom) % w->samples]) / 2;
 				}
 				
-				free(w->data);
+				Sint16 *old = w->data;
+				
+				cyd_lock(&mused.cyd, 1);
 				w->data = new_data;
 				w->samples = new_length;
 				w->loop_begin *= nom;
 				w->loop_end *= nom;
+				cyd_lock(&mused.cyd, 0);
+				
+				free(old);
 				
 				invalidate_wavetable_view();
 			}
@@ -239,18 +203,76 @@ void wavetable_chord(void *transpose, void *unused2, void *unused3)
 }
 
 
-void wavetable_create_one_cycle(void *_settings, void *unused2, void *unused3)
+static void set_one_cycle(CydWavetableEntry *w, Sint16 *new_data, int new_length, int lowest_mul)
 {
-	WgSettings *settings = _settings;
-	CydWavetableEntry *w = &mused.mus.cyd->wavetable_entries[mused.selected_wavetable];
+	if (w->data) free(w->data);
+	w->data = new_data;
+	w->sample_rate = new_length * 220 / lowest_mul;
+	w->samples = new_length;
+	w->loop_begin = 0;
+	w->loop_end = new_length;
+	w->flags = CYD_WAVE_LOOP;
+	w->base_note = (MIDDLE_C + 9 - 12) << 8;
+}
+
+
+static void create_band_limited(WgSettings *settings, int lowest_mul)
+{
+	const int first = mused.selected_wavetable;
+	const int levels = my_min(my_min(WG_MAX_MIPS, my_max(1, settings->mips)), CYD_WAVE_MAX_ENTRIES - first);
+	Sint16 *mip[WG_MAX_MIPS] = { NULL };
 	
-	if (w->samples > 0)
+	// Generate everything first so that running out of memory changes nothing
+	
+	for (int m = 0 ; m < levels ; ++m)
 	{
-		snapshot(S_T_WAVE_DATA);
+		const int new_length = my_max(16, settings->length >> m);
+		
+		// The cycle is tuned so that harmonic h plays at h / lowest_mul times the note frequency
+		
+		const double top_freq = 440.0 * pow(2.0, (settings->top_note + 12 * m - (MIDDLE_C + 9)) / 12.0);
+		const int max_harmonic = mused.mix_rate / 2 * lowest_mul / top_freq;
+		
+		mip[m] = malloc(sizeof(Sint16) * new_length);
+		
+		if (!mip[m] || !wg_gen_bandlimited(settings->chain, settings->num_oscs, mip[m], new_length, max_harmonic))
+		{
+			for (int i = 0 ; i <= m ; ++i)
+				free(mip[i]);
+			
+			set_info_message("Out of memory!");
+			return;
+		}
+		
+		debug("Mip %d: %d samples, %d harmonics", m, new_length, max_harmonic);
+	}
+	
+	// All levels are one undo step, empty slots included
+	
+	if (!snapshot_wave_batch(first, levels))
+	{
+		for (int m = 0 ; m < levels ; ++m)
+			free(mip[m]);
+		
+		set_info_message("Out of memory!");
+		return;
 	}
 	
-	int new_length = settings->length;
-	Sint16 *new_data = malloc(sizeof(Sint16) * new_length);
+	cyd_lock(&mused.cyd, 1);
+	
+	for (int m = 0 ; m < levels ; ++m)
+		set_one_cycle(&mused.mus.cyd->wavetable_entries[first + m], mip[m], my_max(16, settings->length >> m), lowest_mul);
+	
+	cyd_lock(&mused.cyd, 0);
+	
+	invalidate_wavetable_items(first, levels);
+}
+
+
+void wavetable_create_one_cycle(void *_settings, void *unused2, void *unused3)
+{
+	WgSettings *settings = _settings;
+	CydWavetableEntry *w = &mused.mus.cyd->wavetable_entries[mused.selected_wavetable];
 	
 	int lowest_mul = 999;
 	
@@ -259,42 +281,157 @@ void wavetable_create_one_cycle(void *_settings, void *unused2, void *unused3)
 		lowest_mul = my_min(lowest_mul, settings->chain[i].mult);
 	}
 	
-	wg_gen_waveform(settings->chain, settings->num_oscs, new_data, new_length);
-	
-	if (w->data) free(w->data);
-	w->data = new_data;
-	w->sample_rate = new_length * 220 / lowest_mul;
-	w->samples = new_length;
-	w->loop_begin = 0;
-	w->loop_end = new_length;
-	w->flags = CYD_WAVE_LOOP;
-	w->base_note = (MIDDLE_C + 9 - 12) << 8;
+	if (settings->band_limit)
+	{
+		create_band_limited(settings, lowest_mul);
+	}
+	else
+	{
+		if (w->samples > 0)
+		{
+			snapshot(S_T_WAVE_DATA);
+		}
+		
+		int new_length = settings->length;
+		Sint16 *new_data = malloc(sizeof(Sint16) * new_length);
+		
+		if (!new_data)
+		{
+			set_info_message("Out of memory!");
+			return;
+		}
+		
+		wg_gen_waveform(settings->chain, settings->num_oscs, new_data, new_length);
+		
+		cyd_lock(&mused.cyd, 1);
+		set_one_cycle(w, new_data, new_length, lowest_mul);
+		cyd_lock(&mused.cyd, 0);
+	}
 	
 	invalidate_wavetable_view();
 }
 
 
-void wavetable_draw(float x, float y, float width)
+/* A pencil stroke keeps the original samples it has touched and becomes one undo frame when it ends */
+
+static struct
+{
+	int wave;
+	int first, last; // touched by the whole stroke, original[] covers this range
+	int dirty_first, dirty_last; // touched since the last flush
+	Sint16 *original;
+	bool modified;
+} stroke = { -1 };
+
+
+static bool extend_stroke(const CydWavetableEntry *w, int first, int last)
 {
-	snapshot_cascade(S_T_WAVE_DATA, mused.selected_wavetable, 0);
+	if (first >= stroke.first && last <= stroke.last)
+		return true;
+	
+	int new_first = my_min(first, stroke.first), new_last = my_max(last, stroke.last);
+	
+	if (stroke.original)
+	{
+		// Grow at least by the current size so a long stroke is copied only a
+		// few times, the extra samples are still untouched
+		
+		const int grow = stroke.last - stroke.first;
+		
+		if (new_first < stroke.first)
+			new_first = my_max(0, my_min(new_first, stroke.first - grow));
+		
+		if (new_last > stroke.last)
+			new_last = my_min((int)w->samples, my_max(new_last, stroke.last + grow));
+	}
+	
+	Sint16 *original = malloc(sizeof(Sint16) * (new_last - new_first));
+	
+	if (!original)
+		return false;
 	
+	// Samples outside the old range have not been drawn over yet
+	
+	memcpy(original, &w->data[new_first], sizeof(Sint16) * (new_last - new_first));
+	
+	if (stroke.original)
+	{
+		memcpy(&original[stroke.first - new_first], stroke.original, sizeof(Sint16) * (stroke.last - stroke.first));
+		free(stroke.original);
+	}
+	
+	stroke.original = original;
+	stroke.first = new_first;
+	stroke.last = new_last;
+	
+	return true;
+}
+
+
+void wavetable_draw(float x, float y, float width)
+{
 	CydWavetableEntry *w = &mused.mus.cyd->wavetable_entries[mused.selected_wavetable];
 
 	if (w->samples > 0)
 	{
-		debug("draw %f,%f w = %f", x, y, width);
-		int s = w->samples * x;
-		int e = my_max(w->samples * (x + width), s + 1);
+		if (stroke.wave != mused.selected_wavetable)
+		{
+			wavetable_draw_end();
+			
+			stroke.wave = mused.selected_wavetable;
+			stroke.first = stroke.dirty_first = w->samples;
+			stroke.last = stroke.dirty_last = 0;
+			stroke.modified = mused.modified;
+		}
+		
+		int s = my_max(0, my_min(w->samples - 1, (int)(w->samples * x)));
+		int e = my_min(w->samples, my_max((int)(w->samples * (x + width)), s + 1));
 		
-		for ( ; s < e && s < w->samples ; ++s)
+		if (!extend_stroke(w, s, e))
+			return;
+		
+		for (int i = s ; i < e ; ++i)
 		{
-			w->data[s] = y * 65535 - 32768;
+			w->data[i] = y * 65535 - 32768;
 		}
 		
-		invalidate_wavetable_view();
+		stroke.dirty_first = my_min(stroke.dirty_first, s);
+		stroke.dirty_last = my_max(stroke.dirty_last, e);
+		mused.modified = true;
+	}
+}
+
+
+void wavetable_draw_flush()
+{
+	if (stroke.wave != -1 && stroke.dirty_first < stroke.dirty_last)
+	{
+		invalidate_wavetable_range(stroke.dirty_first, stroke.dirty_last);
+		
+		stroke.dirty_first = mused.mus.cyd->wavetable_entries[stroke.wave].samples;
+		stroke.dirty_last = 0;
 	}
 }
 
+
+void wavetable_draw_end()
+{
+	if (stroke.wave == -1)
+		return;
+	
+	wavetable_draw_flush();
+	
+	if (stroke.original && stroke.first < stroke.last)
+	{
+		debug("Stroke changed samples %d-%d", stroke.first, stroke.last - 1);
+		snapshot_wave_range(stroke.wave, stroke.first, stroke.last - stroke.first, stroke.original, stroke.modified);
+	}
+	
+	free(stroke.original);
+	stroke.original = NULL;
+	stroke.wave = -1;
+}
+
 void wavegen_randomize(void *unused1, void *unused2, void *unused3)
 {
 	bool do_sines = !(rndu() & 3);
@@ -382,35 +519,61 @@ void wavetable_amp(void *_amp, void *unused2, void *unused3)
 		int amp = CASTPTR(int, _amp);
 		
 		debug("amp = %d", amp);
-	
-		for (int s = 0 ; s < w->samples ; ++s)
-		{
-			w->data[s] = my_max(my_min((Sint32)w->data[s] * amp / 32768, 32767), -32768);
-		}
+		
+		wk_gain(w->data, w->samples, (float)amp / 32768);
 		
 		invalidate_wavetable_view();
 	}
 }
 
 
-void wavetable_distort(void *_amp, void *unused2, void *unused3)
+static const Sint16 * get_distort_lut()
 {
-	snapshot(S_T_WAVE_DATA);
-		
-	CydWavetableEntry *w = &mused.mus.cyd->wavetable_entries[mused.selected_wavetable];
+	static Sint16 *lut = NULL;
 	
-	if (w->samples > 0)
+	if (!lut)
 	{
-		for (int s = 0 ; s < w->samples ; ++s)
+		lut = malloc(sizeof(Sint16) * 65536);
+		
+		if (!lut)
+			return NULL;
+		
+		for (int i = 0 ; i < 65536 ; ++i)
 		{
-			if (w->data[s] != 0)
+			Sint16 sample = (Sint16)(Uint16)i;
+			
+			if (sample != 0)
 			{
-				float v = (float)w->data[s] / 32768.0;
+				float v = (float)sample / 32768.0;
 				v *= pow(fabs(v), -0.333);
-			
-				w->data[s] = my_max(my_min(v * 32768, 32767), -32768);
+				
+				lut[i] = my_max(my_min(v * 32768, 32767), -32768);
 			}
+			else
+				lut[i] = 0;
 		}
+	}
+	
+	return lut;
+}
+
+
+void wavetable_distort(void *_amp, void *unused2, void *unused3)
+{
+	CydWavetableEntry *w = &mused.mus.cyd->wavetable_entries[mused.selected_wavetable];
+	const Sint16 *lut = get_distort_lut();
+	
+	if (!lut)
+	{
+		set_info_message("Out of memory!");
+		return;
+	}
+	
+	snapshot(S_T_WAVE_DATA);
+	
+	if (w->samples > 0)
+	{
+		wk_shape(w->data, w->samples, lut);
 		
 		invalidate_wavetable_view();
 	}
@@ -424,7 +587,7 @@ void wavetable_randomize_and_create_one_cycle(void *_settings, void *unused2, vo
 }
 
 
-void wavetable_filter(void *_filter_type, void *unused2, void *unused3)
+void wavetable_filter(void *_settings, void *unused2, void *unused3)
 {
 	snapshot(S_T_WAVE_DATA);
 		
@@ -432,24 +595,50 @@ void wavetable_filter(void *_filter_type, void *unused2, void *unused3)
 	
 	if (w->samples > 0)
 	{
-		int filter_type = CASTPTR(int, _filter_type);
+		if (!wb_filter(w, _settings))
+			set_info_message("Out of memory!");
 		
-		Sint16 * temp = malloc(sizeof(Sint16) * w->samples);
-		memcpy(temp, w->data, sizeof(Sint16) * w->samples);
+		invalidate_wavetable_view();
+	}
+}
+
+
+void wavetable_resample(void *_settings, void *unused2, void *unused3)
+{
+	const WrSettings *settings = _settings;
+	CydWavetableEntry *w = &mused.mus.cyd->wavetable_entries[mused.selected_wavetable];
+	
+	if (w->samples > 0 && w->sample_rate > 0 && settings->rate > 0)
+	{
+		snapshot(S_T_WAVE_DATA);
+		
+		// wb_resample() frees the data it replaces, give it a copy so the
+		// player keeps a valid buffer until the swap below
+		
+		CydWavetableEntry resampled = *w;
+		
+		if ((resampled.data = malloc(w->samples * sizeof(w->data[0]))))
+			memcpy(resampled.data, w->data, w->samples * sizeof(w->data[0]));
 		
-		for (int s = 0 ; s < w->samples ; ++s)
+		if (resampled.data && wb_resample(&resampled, settings, true))
 		{
-			int filtered = ((int)temp[(s - 2 + w->samples) % w->samples] + (int)temp[(s - 1 + w->samples) % w->samples] * 2 + (int)temp[s % w->samples] * 4 + (int)temp[(s + 1) % w->samples] * 2 + (int)temp[(s + 2) % w->samples]) / 10;
+			debug("Resampled to %d samples", resampled.samples);
 			
-			if (filter_type == 0)
-				w->data[s] = my_max(my_min(filtered, 32767), -32768);
-			else
-				w->data[s] = my_max(my_min(w->data[s] - filtered, 32767), -32768);
+			cyd_lock(&mused.cyd, 1);
+			
+			free(w->data);
+			*w = resampled;
+			
+			cyd_lock(&mused.cyd, 0);
+			
+			invalidate_wavetable_view();
+		}
+		else
+		{
+			free(resampled.data);
+			undo_pop(&mused.undo);
+			set_info_message("Out of memory!");
 		}
-		
-		free(temp);
-		
-		invalidate_wavetable_view();
 	}
 }
 
@@ -492,6 +681,94 @@ void wavetable_find_zero(void *unused1, void *unused2, void *unused3)
 	}
 }
 
+static bool batch_progress(int done, int total, void *aborted)
+{
+	char message[50];
+	snprintf(message, sizeof(message), "Processing %d/%d...", done, total);
+	
+	if (!progress_box(message, done, total))
+	{
+		*(bool*)aborted = true;
+		return false;
+	}
+	
+	return true;
+}
+
+
+void wavetable_batch_process(void *_settings, void *unused2, void *unused3)
+{
+	const WbSettings *settings = _settings;
+	const int first = my_min(mused.selected_wavetable, settings->last);
+	const int count = my_max(mused.selected_wavetable, settings->last) - first + 1;
+	
+	if (!settings->ops)
+	{
+		set_info_message("No batch operations selected");
+		return;
+	}
+	
+	// Work on copies so an aborted batch leaves the items untouched
+	
+	CydWavetableEntry *entries = calloc(count, sizeof(entries[0]));
+	bool success = entries != NULL;
+	
+	for (int i = 0 ; success && i < count ; ++i)
+	{
+		const CydWavetableEntry *w = &mused.mus.cyd->wavetable_entries[first + i];
+		
+		entries[i] = *w;
+		entries[i].data = NULL;
+		
+		if (w->samples > 0)
+		{
+			if ((entries[i].data = malloc(w->samples * sizeof(w->data[0]))))
+				memcpy(entries[i].data, w->data, w->samples * sizeof(w->data[0]));
+			else
+				success = false;
+		}
+	}
+	
+	WbChain chain = { settings->ops, &mused.wfset, &mused.wrset, 32768 };
+	bool aborted = false;
+	
+	if (success && wb_process(entries, count, &chain, batch_progress, &aborted) && snapshot_wave_batch(first, count))
+	{
+		cyd_lock(&mused.cyd, 1);
+		
+		for (int i = 0 ; i < count ; ++i)
+		{
+			CydWavetableEntry *w = &mused.mus.cyd->wavetable_entries[first + i];
+			
+			if (w->samples > 0)
+			{
+				free(w->data);
+				*w = entries[i];
+				entries[i].data = NULL;
+			}
+		}
+		
+		cyd_lock(&mused.cyd, 0);
+		
+		invalidate_wavetable_items(first, count);
+		
+		set_info_message("Processed items %02X-%02X", first, first + count - 1);
+	}
+	else
+	{
+		set_info_message(aborted ? "Batch aborted" : "Out of memory!");
+	}
+	
+	if (entries)
+	{
+		for (int i = 0 ; i < count ; ++i)
+			free(entries[i].data);
+		
+		free(entries);
+	}
+}
+
+
 void wavegen_load(void *unused1, void *unused2, void *unused3) //weren't there
 {
 	open_data(MAKEPTR(OD_T_WAVEGEN_PATCH), MAKEPTR(OD_A_OPEN), 0);
@@ -16,10 +16,17 @@ void wavegen_save(void *unused1, void *unused2, void *unused3);
 
 void wavegen_preset(void *_preset, void *_settings, void *unused3);
 void wavetable_draw(float x, float y, float w);
+/* Refreshes the display for samples drawn this frame */
+void wavetable_draw_flush();
+/* Ends the pencil stroke and stores it as one undo step */
+void wavetable_draw_end();
 void wavetable_amp(void *amp, void *unused2, void *unused3);
 void wavetable_distort(void *amp, void *unused2, void *unused3);
 void wavetable_remove_dc(void *unused1, void *unused2, void *unused3);
-void wavetable_filter(void *filter_type, void *unused2, void *unused3);
+void wavetable_filter(void *settings, void *unused2, void *unused3);
+void wavetable_resample(void *settings, void *unused2, void *unused3);
 void wavetable_find_zero(void *unused1, void *unused2, void *unused3);
+/* Runs the WbSettings chain on the selected item up to settings->last */
+void wavetable_batch_process(void *settings, void *unused2, void *unused3);
 
 #endif
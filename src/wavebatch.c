@@ -0,0 +1,193 @@
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "wavebatch.h"
+#include "wavekernel.h"
+#include "macros.h"
+#include "snd/freqs.h"
+#include <math.h>
+#include <stdlib.h>
+
+#define MAX_THREADS 16
+
+typedef struct
+{
+	CydWavetableEntry *entries;
+	int count;
+	const WbChain *chain;
+	SDL_atomic_t next, done, failed, abort;
+} Batch;
+
+
+void wb_normalize(CydWavetableEntry *w, int level)
+{
+	if (w->samples > 0)
+	{
+		int m = wk_peak(w->data, w->samples);
+		
+		if (m != 0)
+		{
+			wk_gain(w->data, w->samples, (float)level / m);
+		}
+	}
+}
+
+
+void wb_remove_dc(CydWavetableEntry *w)
+{
+	if (w->samples > 0)
+	{
+		double avg = (double)wk_sum(w->data, w->samples) / w->samples;
+		
+		wk_offset(w->data, w->samples, -(int)floor(avg + 0.5));
+	}
+}
+
+
+bool wb_filter(CydWavetableEntry *w, const WfSettings *settings)
+{
+	if (w->samples > 0)
+		return wf_apply(settings, w->data, w->samples, w->sample_rate, (w->flags & CYD_WAVE_LOOP) != 0);
+	
+	return true;
+}
+
+
+bool wb_resample(CydWavetableEntry *w, const WrSettings *settings, bool threaded)
+{
+	if (w->samples == 0 || w->sample_rate == 0 || settings->rate <= 0)
+		return true;
+	
+	// A higher base note plays the wave back slower so it needs fewer samples to sound the same
+	
+	const int base_note = my_max(0, my_min((FREQ_TAB_SIZE - 1) << 8, (int)w->base_note + settings->transpose * 256));
+	const double ratio = (double)settings->rate / w->sample_rate * pow(2.0, ((int)w->base_note - base_note) / (12.0 * 256));
+	
+	const bool loop = (w->flags & CYD_WAVE_LOOP) && w->loop_end <= w->samples && w->loop_begin < w->loop_end;
+	int new_length;
+	Sint16 *new_data = wr_resample(w->data, w->samples, ratio, settings->taps, loop ? w->loop_begin : 0, loop ? w->loop_end : 0, threaded, &new_length);
+	
+	if (!new_data)
+		return false;
+	
+	w->loop_begin = my_min(new_length, (Uint64)w->loop_begin * new_length / w->samples);
+	w->loop_end = my_min(new_length, (Uint64)w->loop_end * new_length / w->samples);
+	
+	free(w->data);
+	w->data = new_data;
+	w->samples = new_length;
+	w->sample_rate = settings->rate;
+	w->base_note = base_note;
+	
+	return true;
+}
+
+
+static bool process_entry(CydWavetableEntry *w, const WbChain *chain)
+{
+	// Already on a worker, one thread per item is enough
+	
+	if ((chain->ops & WB_RESAMPLE) && !wb_resample(w, chain->resample, false))
+		return false;
+	
+	if (chain->ops & WB_REMOVE_DC)
+		wb_remove_dc(w);
+	
+	if ((chain->ops & WB_FILTER) && !wb_filter(w, chain->filter))
+		return false;
+	
+	if (chain->ops & WB_NORMALIZE)
+		wb_normalize(w, chain->normalize);
+	
+	return true;
+}
+
+
+static int batch_worker(void *data)
+{
+	Batch *batch = data;
+	int i;
+	
+	// Items are handed out one by one since their lengths can differ a lot
+	
+	while (!SDL_AtomicGet(&batch->abort) && (i = SDL_AtomicAdd(&batch->next, 1)) < batch->count)
+	{
+		if (!process_entry(&batch->entries[i], batch->chain))
+			SDL_AtomicSet(&batch->failed, 1);
+		
+		SDL_AtomicAdd(&batch->done, 1);
+	}
+	
+	return 0;
+}
+
+
+bool wb_process(CydWavetableEntry *entries, int count, const WbChain *chain, WbProgress progress, void *context)
+{
+	Batch batch;
+	batch.entries = entries;
+	batch.count = count;
+	batch.chain = chain;
+	SDL_AtomicSet(&batch.next, 0);
+	SDL_AtomicSet(&batch.done, 0);
+	SDL_AtomicSet(&batch.failed, 0);
+	SDL_AtomicSet(&batch.abort, 0);
+	
+	const int num_threads = my_max(1, my_min(count, my_min(MAX_THREADS, SDL_GetCPUCount())));
+	SDL_Thread *threads[MAX_THREADS] = { NULL };
+	int running = 0;
+	
+	for (int t = 0 ; t < num_threads ; ++t)
+	{
+		threads[t] = SDL_CreateThread(batch_worker, "Batch", &batch);
+		
+		if (!threads[t])
+		{
+			warning("SDL_CreateThread failed: %s", SDL_GetError());
+			break;
+		}
+		
+		++running;
+	}
+	
+	if (running == 0)
+	{
+		// Do it all here, no progress display
+		batch_worker(&batch);
+	}
+	
+	while (SDL_AtomicGet(&batch.done) < count && !SDL_AtomicGet(&batch.abort))
+	{
+		if (progress && !progress(SDL_AtomicGet(&batch.done), count, context))
+			SDL_AtomicSet(&batch.abort, 1);
+		else
+			SDL_Delay(10);
+	}
+	
+	for (int t = 0 ; t < running ; ++t)
+		SDL_WaitThread(threads[t], NULL);
+	
+	return !SDL_AtomicGet(&batch.abort) && !SDL_AtomicGet(&batch.failed);
+}
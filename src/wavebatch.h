@@ -0,0 +1,76 @@
+#ifndef WAVEBATCH_H
+#define WAVEBATCH_H
+
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SDL.h"
+#include "snd/cyd.h"
+#include "wavefilter.h"
+#include "waveresample.h"
+#include <stdbool.h>
+
+/*
+Runs a fixed chain of operations over many wavetable items. The items are
+private copies processed on worker threads so that the caller can swap the
+results in and store a single undo step afterwards.
+*/
+
+enum
+{
+	WB_RESAMPLE = 1,
+	WB_REMOVE_DC = 2,
+	WB_FILTER = 4,
+	WB_NORMALIZE = 8
+};
+
+typedef struct
+{
+	int last; // batch covers the selected item up to this one
+	Uint32 ops; // WB_* flags, applied in the order they are listed above
+} WbSettings;
+
+typedef struct
+{
+	Uint32 ops;
+	const WfSettings *filter;
+	const WrSettings *resample;
+	int normalize; // peak level after WB_NORMALIZE
+} WbChain;
+
+/* Called on the calling thread while the workers run, return false to abort */
+typedef bool (*WbProgress)(int done, int total, void *context);
+
+/* Single item operations, the wave actions use these too */
+void wb_normalize(CydWavetableEntry *w, int level);
+void wb_remove_dc(CydWavetableEntry *w);
+bool wb_filter(CydWavetableEntry *w, const WfSettings *settings);
+/* Replaces w->data with a new buffer, see wr_resample() for threaded */
+bool wb_resample(CydWavetableEntry *w, const WrSettings *settings, bool threaded);
+
+/* Processes entries in place, returns false if aborted or out of memory (some entries may be done already) */
+bool wb_process(CydWavetableEntry *entries, int count, const WbChain *chain, WbProgress progress, void *context);
+
+#endif
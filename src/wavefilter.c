@@ -0,0 +1,394 @@
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "wavefilter.h"
+#include "wavekernel.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Kernels longer than this are convolved via FFT
+#define DIRECT_MAX_TAPS 64
+
+// Samples run through a biquad before a cyclic wave to settle its state
+#define BIQUAD_WARMUP 8192
+
+const char *wf_type_name[WF_NUM_TYPES] =
+{
+	"LOWPASS",
+	"HIGHPASS",
+	"BANDPASS",
+	"NOTCH",
+	"LOSHELF",
+	"HISHELF",
+	"FIR LP",
+	"FIR HP"
+};
+
+typedef struct
+{
+	float b0, b1, b2, a1, a2;
+} Biquad;
+
+
+bool wf_is_fir(WfType type)
+{
+	return type == WF_FIR_LOWPASS || type == WF_FIR_HIGHPASS;
+}
+
+
+static Sint16 to_sample(float v)
+{
+	if (v >= 32767.0f)
+		return 32767;
+	else if (v <= -32768.0f)
+		return -32768;
+	
+	return (Sint16)lrintf(v);
+}
+
+
+/* Coefficients from the RBJ Audio EQ Cookbook */
+
+static void design_biquad(Biquad *bq, WfType type, double w0, double q, double gain_db)
+{
+	const double cs = cos(w0), sn = sin(w0);
+	const double alpha = sn / (2 * q);
+	const double A = pow(10, gain_db / 40);
+	double b0, b1, b2, a0, a1, a2;
+	
+	switch (type)
+	{
+		default:
+		case WF_LOWPASS:
+			b0 = (1 - cs) / 2; b1 = 1 - cs; b2 = (1 - cs) / 2;
+			a0 = 1 + alpha; a1 = -2 * cs; a2 = 1 - alpha;
+			break;
+			
+		case WF_HIGHPASS:
+			b0 = (1 + cs) / 2; b1 = -(1 + cs); b2 = (1 + cs) / 2;
+			a0 = 1 + alpha; a1 = -2 * cs; a2 = 1 - alpha;
+			break;
+			
+		case WF_BANDPASS:
+			b0 = alpha; b1 = 0; b2 = -alpha;
+			a0 = 1 + alpha; a1 = -2 * cs; a2 = 1 - alpha;
+			break;
+			
+		case WF_NOTCH:
+			b0 = 1; b1 = -2 * cs; b2 = 1;
+			a0 = 1 + alpha; a1 = -2 * cs; a2 = 1 - alpha;
+			break;
+			
+		case WF_LOWSHELF:
+		{
+			const double sq = 2 * sqrt(A) * alpha;
+			b0 = A * ((A + 1) - (A - 1) * cs + sq);
+			b1 = 2 * A * ((A - 1) - (A + 1) * cs);
+			b2 = A * ((A + 1) - (A - 1) * cs - sq);
+			a0 = (A + 1) + (A - 1) * cs + sq;
+			a1 = -2 * ((A - 1) + (A + 1) * cs);
+			a2 = (A + 1) + (A - 1) * cs - sq;
+		}
+		break;
+			
+		case WF_HIGHSHELF:
+		{
+			const double sq = 2 * sqrt(A) * alpha;
+			b0 = A * ((A + 1) + (A - 1) * cs + sq);
+			b1 = -2 * A * ((A - 1) + (A + 1) * cs);
+			b2 = A * ((A + 1) + (A - 1) * cs - sq);
+			a0 = (A + 1) - (A - 1) * cs + sq;
+			a1 = 2 * ((A - 1) - (A + 1) * cs);
+			a2 = (A + 1) - (A - 1) * cs - sq;
+		}
+		break;
+	}
+	
+	bq->b0 = b0 / a0;
+	bq->b1 = b1 / a0;
+	bq->b2 = b2 / a0;
+	bq->a1 = a1 / a0;
+	bq->a2 = a2 / a0;
+}
+
+
+static void apply_biquad(const Biquad *bq, Sint16 *data, int samples, bool wrap)
+{
+	// Transposed direct form II
+	
+	float z1 = 0, z2 = 0;
+	
+	if (wrap)
+	{
+		const int warmup = samples < BIQUAD_WARMUP ? samples : BIQUAD_WARMUP;
+		
+		for (int s = samples - warmup ; s < samples ; ++s)
+		{
+			const float x = data[s];
+			const float y = bq->b0 * x + z1;
+			z1 = bq->b1 * x - bq->a1 * y + z2;
+			z2 = bq->b2 * x - bq->a2 * y;
+		}
+	}
+	
+	for (int s = 0 ; s < samples ; ++s)
+	{
+		const float x = data[s];
+		const float y = bq->b0 * x + z1;
+		z1 = bq->b1 * x - bq->a1 * y + z2;
+		z2 = bq->b2 * x - bq->a2 * y;
+		data[s] = to_sample(y);
+	}
+}
+
+
+/* Blackman windowed sinc, highpass by spectral inversion */
+
+static void design_sinc(float *kernel, int taps, WfType type, double fc)
+{
+	const int half = taps / 2;
+	double sum = 0;
+	
+	for (int i = 0 ; i < taps ; ++i)
+	{
+		const int n = i - half;
+		const double sinc = n == 0 ? 2 * fc : sin(2 * M_PI * fc * n) / (M_PI * n);
+		const double window = 0.42 - 0.5 * cos(2 * M_PI * i / (taps - 1)) + 0.08 * cos(4 * M_PI * i / (taps - 1));
+		kernel[i] = sinc * window;
+		sum += kernel[i];
+	}
+	
+	for (int i = 0 ; i < taps ; ++i)
+		kernel[i] /= sum;
+	
+	if (type == WF_FIR_HIGHPASS)
+	{
+		for (int i = 0 ; i < taps ; ++i)
+			kernel[i] = -kernel[i];
+		
+		kernel[half] += 1.0f;
+	}
+}
+
+
+
+void wf_fft(float *re, float *im, int n, bool inverse)
+{
+	for (int i = 1, j = 0 ; i < n ; ++i)
+	{
+		int bit = n >> 1;
+		
+		for (; j & bit ; bit >>= 1)
+			j ^= bit;
+		
+		j ^= bit;
+		
+		if (i < j)
+		{
+			float t = re[i]; re[i] = re[j]; re[j] = t;
+			t = im[i]; im[i] = im[j]; im[j] = t;
+		}
+	}
+	
+	for (int len = 2 ; len <= n ; len <<= 1)
+	{
+		const double angle = (inverse ? 2 : -2) * M_PI / len;
+		const float wr = cos(angle), wi = sin(angle);
+		
+		for (int i = 0 ; i < n ; i += len)
+		{
+			float cr = 1, ci = 0;
+			
+			for (int k = 0 ; k < len / 2 ; ++k)
+			{
+				const int a = i + k, b = i + k + len / 2;
+				const float tr = re[b] * cr - im[b] * ci;
+				const float ti = re[b] * ci + im[b] * cr;
+				
+				re[b] = re[a] - tr;
+				im[b] = im[a] - ti;
+				re[a] += tr;
+				im[a] += ti;
+				
+				const float t = cr * wr - ci * wi;
+				ci = cr * wi + ci * wr;
+				cr = t;
+			}
+		}
+	}
+}
+
+
+/* out[i] = sum(kernel[k] * in[i + k]), in has samples + taps - 1 elements */
+
+static void convolve_direct(const float *kernel, int taps, const float * restrict in, float * restrict out, int samples)
+{
+	for (int i = 0 ; i < samples ; ++i)
+		out[i] = wk_dot(kernel, &in[i], taps);
+}
+
+
+/* Same as convolve_direct() using overlap-save, the kernel must be symmetric */
+
+static bool convolve_fft(const float *kernel, int taps, const float *in, float *out, int samples)
+{
+	int n = 1;
+	
+	while (n < taps * 4)
+		n <<= 1;
+	
+	const int step = n - taps + 1;
+	const int in_length = samples + taps - 1;
+	
+	float *buffer = malloc(sizeof(float) * n * 4);
+	
+	if (!buffer)
+		return false;
+	
+	float *hre = buffer, *him = buffer + n, *re = buffer + n * 2, *im = buffer + n * 3;
+	
+	memset(hre, 0, sizeof(float) * n * 2);
+	memcpy(hre, kernel, sizeof(float) * taps);
+	wf_fft(hre, him, n, false);
+	
+	for (int pos = 0 ; pos < samples ; pos += step)
+	{
+		const int avail = in_length - pos < n ? in_length - pos : n;
+		
+		memcpy(re, &in[pos], sizeof(float) * avail);
+		memset(&re[avail], 0, sizeof(float) * (n - avail));
+		memset(im, 0, sizeof(float) * n);
+		
+		wf_fft(re, im, n, false);
+		
+		wk_complex_mul(re, im, hre, him, n);
+		
+		wf_fft(re, im, n, true);
+		
+		// The first taps - 1 results are wrapped around and discarded
+		
+		for (int j = taps - 1 ; j < n && pos + j - (taps - 1) < samples ; ++j)
+			out[pos + j - (taps - 1)] = re[j] / n;
+	}
+	
+	free(buffer);
+	
+	return true;
+}
+
+
+static bool apply_fir(const float *kernel, int taps, Sint16 *data, int samples, bool wrap)
+{
+	const int half = taps / 2;
+	float *in = malloc(sizeof(float) * (samples + taps - 1));
+	float *out = malloc(sizeof(float) * samples);
+	bool ok = false;
+	
+	if (in && out)
+	{
+		// Only the padding on both ends needs the wrap-around indexing
+		
+		for (int i = 0 ; i < half ; ++i)
+		{
+			const int s = i - half;
+			in[i] = wrap ? data[((s % samples) + samples) % samples] : 0;
+		}
+		
+		for (int s = 0 ; s < samples ; ++s)
+			in[half + s] = data[s];
+		
+		for (int i = 0 ; i < half ; ++i)
+			in[half + samples + i] = wrap ? data[i % samples] : 0;
+		
+		if (taps <= DIRECT_MAX_TAPS)
+		{
+			convolve_direct(kernel, taps, in, out, samples);
+			ok = true;
+		}
+		else
+			ok = convolve_fft(kernel, taps, in, out, samples);
+		
+		if (ok)
+		{
+			for (int s = 0 ; s < samples ; ++s)
+				data[s] = to_sample(out[s]);
+		}
+	}
+	
+	free(in);
+	free(out);
+	
+	return ok;
+}
+
+
+bool wf_apply(const WfSettings *settings, Sint16 *data, int samples, int sample_rate, bool wrap)
+{
+	if (samples <= 0 || sample_rate <= 0)
+		return true;
+	
+	double fc = (double)settings->cutoff / sample_rate;
+	
+	if (fc > 0.49)
+		fc = 0.49;
+	else if (fc < 0.0001)
+		fc = 0.0001;
+	
+	if (wf_is_fir(settings->type))
+	{
+		int taps = settings->taps | 1;
+		
+		if (taps < WF_MIN_TAPS)
+			taps = WF_MIN_TAPS;
+		else if (taps > WF_MAX_TAPS)
+			taps = WF_MAX_TAPS;
+		
+		float *kernel = malloc(sizeof(float) * taps);
+		
+		if (!kernel)
+			return false;
+		
+		design_sinc(kernel, taps, settings->type, fc);
+		
+		bool ok = apply_fir(kernel, taps, data, samples, wrap);
+		
+		free(kernel);
+		
+		return ok;
+	}
+	else
+	{
+		Biquad bq;
+		design_biquad(&bq, settings->type, 2 * M_PI * fc, settings->q > 0 ? settings->q / 100.0 : 0.01, settings->gain);
+		apply_biquad(&bq, data, samples, wrap);
+		
+		return true;
+	}
+}
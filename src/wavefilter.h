@@ -0,0 +1,67 @@
+#ifndef WAVEFILTER_H
+#define WAVEFILTER_H
+
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SDL.h"
+#include <stdbool.h>
+
+typedef enum
+{
+	WF_LOWPASS,
+	WF_HIGHPASS,
+	WF_BANDPASS,
+	WF_NOTCH,
+	WF_LOWSHELF,
+	WF_HIGHSHELF,
+	WF_FIR_LOWPASS,
+	WF_FIR_HIGHPASS,
+	WF_NUM_TYPES
+} WfType;
+
+typedef struct
+{
+	WfType type;
+	int cutoff; // Hz
+	int q; // resonance * 100, biquads only
+	int gain; // dB, shelves only
+	int taps; // FIR only, odd
+} WfSettings;
+
+#define WF_MIN_TAPS 3
+#define WF_MAX_TAPS 4095
+
+extern const char *wf_type_name[WF_NUM_TYPES];
+
+bool wf_is_fir(WfType type);
+
+/* Filters data in place. If wrap is set the wave is treated as cyclic, otherwise it is zero padded */
+bool wf_apply(const WfSettings *settings, Sint16 *data, int samples, int sample_rate, bool wrap);
+
+/* In-place radix-2 complex FFT, n must be a power of two. The inverse is not scaled */
+void wf_fft(float *re, float *im, int n, bool inverse);
+
+#endif
@@ -1,9 +1,12 @@
 #include "wavegen.h"
 #include "util/rnd.h"
 #include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
 #include "macros.h"
 
 #include "combWFgen.h" //wasn't there
+#include "wavefilter.h"
 
 float wg_osc(WgOsc *osc, float _phase)
 {
@@ -130,22 +133,404 @@ void wg_init_osc(WgOsc *osc)
 }
 
 
-void wg_gen_waveform(WgOsc *chain, int num_oscs, Sint16 *data, int len)
+#define SINE_TAB_SIZE 4096
+#define EXP_TAB_SIZE 4096
+#define WARP_TAB_SIZE 8192
+#define WARP_EXACT_BELOW (16.0f / WARP_TAB_SIZE)
+#define MAX_WARP_EXP 100
+#define BLOCK_SIZE 256
+// Band limited waves are analyzed from a naive render this long
+#define ANALYSIS_SIZE 65536
+
+// All tables have one extra entry so interpolation needs no wrapping
+
+static float sine_tab[SINE_TAB_SIZE + 1];
+static float exp_tab[EXP_TAB_SIZE + 1]; // 2^(-64 * x) for x in 0..0.5
+static float *warp_tab[MAX_WARP_EXP + 1];
+
+
+static void init_tables()
+{
+	static bool initialized = false;
+	
+	if (initialized)
+		return;
+	
+	for (int i = 0 ; i <= SINE_TAB_SIZE ; ++i)
+		sine_tab[i] = sin((double)i / SINE_TAB_SIZE * M_PI * 2.0);
+	
+	for (int i = 0 ; i <= EXP_TAB_SIZE ; ++i)
+		exp_tab[i] = pow(2.0, -1.0 * ((double)i / EXP_TAB_SIZE * 0.5) * 64);
+	
+	initialized = true;
+}
+
+
+static const float * get_warp_tab(int exp, float exp_c)
+{
+	if (exp < 0 || exp > MAX_WARP_EXP)
+		return NULL;
+	
+	if (!warp_tab[exp])
+	{
+		float *tab = malloc(sizeof(float) * (WARP_TAB_SIZE + 1));
+		
+		if (!tab)
+			return NULL;
+		
+		for (int i = 0 ; i <= WARP_TAB_SIZE ; ++i)
+			tab[i] = pow((double)i / WARP_TAB_SIZE, exp_c);
+		
+		warp_tab[exp] = tab;
+	}
+	
+	return warp_tab[exp];
+}
+
+
+/* Exact at the threshold so ties land on the same side as in wg_osc() */
+
+static inline bool past_half(const WgKernelOsc *k, float raw)
+{
+	if (fabsf(raw - k->half) > 1e-4f)
+		return raw >= k->half;
+	
+	return pow(raw, k->exp_c) >= 0.5;
+}
+
+
+static inline float lookup(const float *tab, int size, float x)
+{
+	const float pos = x * size;
+	const int i = my_min((int)pos, size - 1);
+	return tab[i] + (tab[i + 1] - tab[i]) * (pos - i);
+}
+
+
+void wg_compile(WgKernel *kernel, WgOsc *chain, int num_oscs)
+{
+	init_tables();
+	
+	kernel->num_oscs = num_oscs;
+	
+	for (int i = 0 ; i < num_oscs ; ++i)
+	{
+		WgOsc *osc = &chain[i];
+		WgKernelOsc *k = &kernel->osc[i];
+		
+		wg_init_osc(osc);
+		
+		k->osc = osc->osc;
+		k->op = osc->op;
+		k->mult = osc->mult;
+		k->shift = (float)osc->shift / 16;
+		k->vol = (float)osc->vol / 255;
+		k->exp_c = osc->exp_c;
+		k->half = pow(0.5, 1.0 / osc->exp_c);
+		k->warp = osc->exp_c == 1.0f ? NULL : get_warp_tab(osc->exp, osc->exp_c);
+		k->scale = 1.0f;
+		k->offset = 0.0f;
+		
+		if (osc->flags & WG_OSC_FLAG_ABS)
+		{
+			k->scale = 0.5f;
+			k->offset = 0.5f;
+		}
+		
+		if (osc->flags & WG_OSC_FLAG_NEG)
+		{
+			k->scale = -k->scale;
+			k->offset = -k->offset;
+		}
+	}
+}
+
+
+void wg_render_osc(const WgKernelOsc *k, int first, int len, int total, float *output)
+{
+	float raw[BLOCK_SIZE], phase[BLOCK_SIZE];
+	
+	for (int base = 0 ; base < len ; base += BLOCK_SIZE)
+	{
+		const int n = my_min(BLOCK_SIZE, len - base);
+		float *out = &output[base];
+		
+		for (int i = 0 ; i < n ; ++i)
+		{
+			float p = ((float)(first + base + i) / total) * k->mult + k->shift;
+			raw[i] = phase[i] = p - (int)p;
+		}
+		
+		if (k->warp)
+		{
+			// The curve is steepest near zero, computed exactly there
+			
+			for (int i = 0 ; i < n ; ++i)
+				phase[i] = raw[i] < WARP_EXACT_BELOW ? pow(raw[i], k->exp_c) : lookup(k->warp, WARP_TAB_SIZE, raw[i]);
+		}
+		else if (k->exp_c != 1.0f)
+		{
+			// exp outside the table range
+			for (int i = 0 ; i < n ; ++i)
+				phase[i] = pow(raw[i], k->exp_c);
+		}
+		
+		// Discontinuities are tested on the unwarped phase so the table error cannot move them
+		
+		switch (k->osc)
+		{
+			default:
+			
+			case WG_OSC_SINE:
+				for (int i = 0 ; i < n ; ++i)
+					out[i] = lookup(sine_tab, SINE_TAB_SIZE, phase[i]) * k->vol;
+				break;
+				
+			case WG_OSC_SQUARE:
+				for (int i = 0 ; i < n ; ++i)
+					out[i] = past_half(k, raw[i]) ? -k->vol : k->vol;
+				break;
+				
+			case WG_OSC_TRIANGLE:
+				for (int i = 0 ; i < n ; ++i)
+					out[i] = (phase[i] < 0.5f ? phase[i] * 4.0f - 1.0f : 1.0f - (phase[i] - 0.5f) * 4.0f) * k->vol;
+				break;
+				
+			case WG_OSC_SAW:
+				for (int i = 0 ; i < n ; ++i)
+					out[i] = (phase[i] * 2.0f - 1.0f) * k->vol;
+				break;
+				
+			case WG_OSC_EXP:
+				for (int i = 0 ; i < n ; ++i)
+				{
+					if (!past_half(k, raw[i]))
+						out[i] = -lookup(exp_tab, EXP_TAB_SIZE, phase[i] * 2) * k->vol;
+					else
+						out[i] = lookup(exp_tab, EXP_TAB_SIZE, (1.0f - phase[i]) * 2) * k->vol;
+				}
+				break;
+				
+			case WG_OSC_NOISE:
+				for (int i = 0 ; i < n ; ++i)
+					out[i] = (rndf() * 2.0f - 1.0f) * k->vol;
+				break;
+		}
+		
+		if (k->scale != 1.0f || k->offset != 0.0f)
+		{
+			for (int i = 0 ; i < n ; ++i)
+				out[i] = out[i] * k->scale + k->offset;
+		}
+	}
+}
+
+
+void wg_render(const WgKernel *kernel, int first, int len, int total, float *output)
+{
+	float temp[BLOCK_SIZE];
+	
+	for (int base = 0 ; base < len ; base += BLOCK_SIZE)
+	{
+		const int n = my_min(BLOCK_SIZE, len - base);
+		float *out = &output[base];
+		WgOpType op = WG_OP_ADD;
+		
+		for (int i = 0 ; i < n ; ++i)
+			out[i] = 0;
+		
+		for (int o = 0 ; o < kernel->num_oscs ; ++o)
+		{
+			const WgKernelOsc *k = &kernel->osc[o];
+			
+			wg_render_osc(k, first + base, n, total, temp);
+			
+			if (op == WG_OP_MUL)
+			{
+				for (int i = 0 ; i < n ; ++i)
+					out[i] *= temp[i];
+			}
+			else
+			{
+				for (int i = 0 ; i < n ; ++i)
+					out[i] += temp[i];
+			}
+			
+			op = k->op;
+		}
+	}
+}
+
+
+Uint32 wg_hash(const WgOsc *chain, int num_oscs)
 {
+	// FNV-1a over the fields, the struct itself has padding and the derived exp_c
+	
+	Uint32 hash = 2166136261u;
+	
 	for (int i = 0 ; i < num_oscs ; ++i)
 	{
-		wg_init_osc(&chain[i]);
+		const WgOsc *osc = &chain[i];
+		const Uint32 fields[] = { osc->osc, osc->op, osc->mult, osc->shift, osc->exp, osc->vol, osc->flags };
+		
+		for (int f = 0 ; f < sizeof(fields) / sizeof(fields[0]) ; ++f)
+			for (int b = 0 ; b < 32 ; b += 8)
+				hash = (hash ^ ((fields[f] >> b) & 0xff)) * 16777619u;
 	}
+	
+	return hash;
+}
+
+
+void wg_gen_waveform(WgOsc *chain, int num_oscs, Sint16 *data, int len)
+{
+	WgKernel kernel;
+	float block[BLOCK_SIZE];
+	
+	wg_compile(&kernel, chain, num_oscs);
 
+	for (int base = 0 ; base < len ; base += BLOCK_SIZE)
+	{
+		const int n = my_min(BLOCK_SIZE, len - base);
+		
+		wg_render(&kernel, base, n, len, block);
+		
+		for (int i = 0 ; i < n ; ++i)
+		{
+			float s = block[i];
+			
+			if (s > 1.0f)
+				s = 1.0f;
+			else if (s < -1.0f)
+				s = -1.0f;
+				
+			data[base + i] = 32767 * s;
+		}
+	}
+}
+
+
+/* Removing harmonics makes edges overshoot (Gibbs), scale down instead of clipping */
+
+static void write_normalized(Sint16 *data, const float *wave, int len, float scale)
+{
+	float peak = 0;
+	
 	for (int i = 0 ; i < len ; ++i)
+		peak = my_max(peak, fabsf(wave[i] / scale));
+	
+	if (peak > 1.0f)
+		scale *= peak;
+	
+	for (int i = 0 ; i < len ; ++i)
+		data[i] = my_max(-32767, my_min(32767, (int)(32767 * wave[i] / scale)));
+}
+
+
+bool wg_gen_bandlimited(WgOsc *chain, int num_oscs, Sint16 *data, int len, int max_harmonic)
+{
+	// Render the naive cycle oversampled, take its harmonics and resynthesize only those that fit
+	
+	int n = ANALYSIS_SIZE;
+	
+	while (n < len * 2)
+		n <<= 1;
+	
+	max_harmonic = my_max(0, my_min(max_harmonic, my_min(len / 2 - 1, n / 2 - 1)));
+	
+	float *re = malloc(sizeof(float) * n);
+	float *im = calloc(n, sizeof(float));
+	
+	if (!re || !im)
+	{
+		free(re);
+		free(im);
+		return false;
+	}
+	
+	WgKernel kernel;
+	wg_compile(&kernel, chain, num_oscs);
+	wg_render(&kernel, 0, n, n, re);
+	
+	for (int i = 0 ; i < n ; ++i)
+		re[i] = my_max(-1.0f, my_min(1.0f, re[i]));
+	
+	wf_fft(re, im, n, false);
+	
+	if ((len & (len - 1)) == 0)
+	{
+		// Power of two: drop the harmonics and run the inverse at the target length
+		
+		float *ore = calloc(len, sizeof(float));
+		float *oim = calloc(len, sizeof(float));
+		
+		if (!ore || !oim)
+		{
+			free(ore);
+			free(oim);
+			free(re);
+			free(im);
+			return false;
+		}
+		
+		ore[0] = re[0];
+		
+		for (int h = 1 ; h <= max_harmonic ; ++h)
+		{
+			ore[h] = re[h];
+			oim[h] = im[h];
+			ore[len - h] = re[h];
+			oim[len - h] = -im[h];
+		}
+		
+		wf_fft(ore, oim, len, true);
+		
+		write_normalized(data, ore, len, n);
+		
+		free(ore);
+		free(oim);
+	}
+	else
 	{
-		double s = wg_get_sample(chain, num_oscs, (float)i / len);
+		// Additive synthesis, each harmonic is advanced by rotation
 		
-		if (s > 1.0)
-			s = 1.0;
-		else if (s < -1.0)
-			s = -1.0;
+		float *out = malloc(sizeof(float) * len);
+		
+		if (!out)
+		{
+			free(re);
+			free(im);
+			return false;
+		}
+		
+		for (int i = 0 ; i < len ; ++i)
+			out[i] = re[0];
+		
+		for (int h = 1 ; h <= max_harmonic ; ++h)
+		{
+			const double step = 2.0 * M_PI * h / len;
+			const double sr = cos(step), si = sin(step);
+			const double a = 2.0 * re[h], b = 2.0 * im[h];
+			double c = 1, s = 0;
 			
-		data[i] = 32767 * s;
+			for (int i = 0 ; i < len ; ++i)
+			{
+				// Re((a + ib) * e^(i * step * i))
+				out[i] += a * c - b * s;
+				
+				const double t = c * sr - s * si;
+				s = c * si + s * sr;
+				c = t;
+			}
+		}
+		
+		write_normalized(data, out, len, n);
+		
+		free(out);
 	}
+	
+	free(re);
+	free(im);
+	
+	return true;
 }
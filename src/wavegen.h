@@ -1,8 +1,10 @@
 #pragma once
 
 #include "SDL.h"
+#include <stdbool.h>
 
 #define WG_CHAIN_OSCS 8 //was 4
+#define WG_MAX_MIPS 10
 
 typedef enum
 {
@@ -45,6 +47,11 @@ typedef struct
 {
 	WgOsc chain[WG_CHAIN_OSCS];
 	int num_oscs, length;
+	
+	// Not stored in patches
+	bool band_limit;
+	int top_note; // highest note the band limited wave is clean for
+	int mips; // octave spaced variants written in the following slots
 } WgSettings;
 
 typedef struct
@@ -53,7 +60,36 @@ typedef struct
 	WgSettings settings;
 } WgPreset;
 
+/* Oscillator chain precomputed for wg_render() */
+
+typedef struct
+{
+	WgOscType osc;
+	WgOpType op;
+	float mult, shift, vol;
+	float scale, offset; // WG_OSC_FLAG_ABS and WG_OSC_FLAG_NEG folded together
+	float exp_c;
+	float half; // unwarped phase that warps to 0.5
+	const float *warp; // phase^exp_c table, NULL if exp_c is 1
+} WgKernelOsc;
+
+typedef struct
+{
+	WgKernelOsc osc[WG_CHAIN_OSCS];
+	int num_oscs;
+} WgKernel;
+
+void wg_compile(WgKernel *kernel, WgOsc *chain, int num_oscs);
+/* output[i] = chain evaluated at phase (first + i) / total, not clamped */
+void wg_render(const WgKernel *kernel, int first, int len, int total, float *output);
+/* Same for a single oscillator */
+void wg_render_osc(const WgKernelOsc *osc, int first, int len, int total, float *output);
+
 void wg_gen_waveform(WgOsc *chain, int num_oscs, Sint16 *data, int len);
+/* Hash of the parameters that affect the output of the chain */
+Uint32 wg_hash(const WgOsc *chain, int num_oscs);
+/* Like wg_gen_waveform() with only harmonics 1..max_harmonic of the cycle kept */
+bool wg_gen_bandlimited(WgOsc *chain, int num_oscs, Sint16 *data, int len, int max_harmonic);
 float wg_osc(WgOsc *osc, float _phase);
 void wg_init_osc(WgOsc *osc);
 float wg_get_sample(WgOsc *chain, int num_oscs, float phase);
@@ -0,0 +1,348 @@
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "wavekernel.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+
+static inline Sint16 saturate(int value)
+{
+	if (value > 32767)
+		return 32767;
+	else if (value < -32768)
+		return -32768;
+	
+	return value;
+}
+
+
+int wk_peak(const Sint16 *data, int samples)
+{
+	int s = 0, lo = 0, hi = 0;
+	
+#if defined(__AVX2__)
+	__m256i vlo = _mm256_setzero_si256(), vhi = _mm256_setzero_si256();
+	
+	for (; s + 16 <= samples ; s += 16)
+	{
+		__m256i v = _mm256_loadu_si256((const __m256i*)&data[s]);
+		vlo = _mm256_min_epi16(vlo, v);
+		vhi = _mm256_max_epi16(vhi, v);
+	}
+	
+	Sint16 tlo[16], thi[16];
+	_mm256_storeu_si256((__m256i*)tlo, vlo);
+	_mm256_storeu_si256((__m256i*)thi, vhi);
+	
+	for (int i = 0 ; i < 16 ; ++i)
+	{
+		if (tlo[i] < lo) lo = tlo[i];
+		if (thi[i] > hi) hi = thi[i];
+	}
+#elif defined(__SSE2__)
+	__m128i vlo = _mm_setzero_si128(), vhi = _mm_setzero_si128();
+	
+	for (; s + 8 <= samples ; s += 8)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)&data[s]);
+		vlo = _mm_min_epi16(vlo, v);
+		vhi = _mm_max_epi16(vhi, v);
+	}
+	
+	Sint16 tlo[8], thi[8];
+	_mm_storeu_si128((__m128i*)tlo, vlo);
+	_mm_storeu_si128((__m128i*)thi, vhi);
+	
+	for (int i = 0 ; i < 8 ; ++i)
+	{
+		if (tlo[i] < lo) lo = tlo[i];
+		if (thi[i] > hi) hi = thi[i];
+	}
+#endif
+
+	for (; s < samples ; ++s)
+	{
+		if (data[s] < lo) lo = data[s];
+		if (data[s] > hi) hi = data[s];
+	}
+	
+	return -lo > hi ? -lo : hi;
+}
+
+
+Sint64 wk_sum(const Sint16 *data, int samples)
+{
+	int s = 0;
+	Sint64 sum = 0;
+	
+#if defined(__SSE2__)
+	const __m128i ones = _mm_set1_epi16(1);
+	
+	while (s + 8 <= samples)
+	{
+		// Each 32-bit lane grows by at most 65536 per step so flush to 64 bits every 16384 steps
+		
+		__m128i acc = _mm_setzero_si128();
+		
+		for (int i = 0 ; i < 16384 && s + 8 <= samples ; ++i, s += 8)
+			acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_loadu_si128((const __m128i*)&data[s]), ones));
+		
+		Sint32 lanes[4];
+		_mm_storeu_si128((__m128i*)lanes, acc);
+		sum += (Sint64)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	}
+#endif
+
+	for (; s < samples ; ++s)
+		sum += data[s];
+	
+	return sum;
+}
+
+
+void wk_gain(Sint16 *data, int samples, float gain)
+{
+	int s = 0;
+	
+#if defined(__AVX2__)
+	const __m256 g = _mm256_set1_ps(gain);
+	
+	for (; s + 16 <= samples ; s += 16)
+	{
+		__m256i v = _mm256_loadu_si256((const __m256i*)&data[s]);
+		__m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(v));
+		__m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(v, 1));
+		lo = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(lo), g));
+		hi = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(hi), g));
+		
+		// packs works within 128-bit lanes, permute restores the sample order
+		_mm256_storeu_si256((__m256i*)&data[s], _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xd8));
+	}
+#elif defined(__SSE2__)
+	const __m128 g = _mm_set1_ps(gain);
+	
+	for (; s + 8 <= samples ; s += 8)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)&data[s]);
+		__m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+		__m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+		lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(lo), g));
+		hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(hi), g));
+		_mm_storeu_si128((__m128i*)&data[s], _mm_packs_epi32(lo, hi));
+	}
+#endif
+
+	for (; s < samples ; ++s)
+	{
+		float v = data[s] * gain;
+		
+		if (v >= 32767)
+			data[s] = 32767;
+		else if (v <= -32768)
+			data[s] = -32768;
+		else
+			data[s] = (int)v;
+	}
+}
+
+
+void wk_offset(Sint16 *data, int samples, int offset)
+{
+	// Anything beyond saturates every sample anyway and both halves below
+	// must fit in a Sint16 (65535 would give 32767 + 32768)
+	
+	if (offset > 65534)
+		offset = 65534;
+	else if (offset < -65534)
+		offset = -65534;
+	
+	int s = 0;
+	
+	// Both halves have the same sign so saturating twice equals saturating once
+	
+#if defined(__AVX2__)
+	const __m256i a = _mm256_set1_epi16(offset / 2), b = _mm256_set1_epi16(offset - offset / 2);
+	
+	for (; s + 16 <= samples ; s += 16)
+	{
+		__m256i v = _mm256_loadu_si256((const __m256i*)&data[s]);
+		_mm256_storeu_si256((__m256i*)&data[s], _mm256_adds_epi16(_mm256_adds_epi16(v, a), b));
+	}
+#elif defined(__SSE2__)
+	const __m128i a = _mm_set1_epi16(offset / 2), b = _mm_set1_epi16(offset - offset / 2);
+	
+	for (; s + 8 <= samples ; s += 8)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)&data[s]);
+		_mm_storeu_si128((__m128i*)&data[s], _mm_adds_epi16(_mm_adds_epi16(v, a), b));
+	}
+#endif
+
+	for (; s < samples ; ++s)
+		data[s] = saturate(data[s] + offset);
+}
+
+
+void wk_shape(Sint16 *data, int samples, const Sint16 *lut)
+{
+	// There is no 16-bit gather so this stays scalar; the table lookup is what makes it fast
+	
+	int s = 0;
+	
+	for (; s + 4 <= samples ; s += 4)
+	{
+		Sint16 a = lut[(Uint16)data[s]], b = lut[(Uint16)data[s + 1]];
+		Sint16 c = lut[(Uint16)data[s + 2]], d = lut[(Uint16)data[s + 3]];
+		data[s] = a;
+		data[s + 1] = b;
+		data[s + 2] = c;
+		data[s + 3] = d;
+	}
+	
+	for (; s < samples ; ++s)
+		data[s] = lut[(Uint16)data[s]];
+}
+
+
+void wk_mask(Sint16 *data, int samples, Uint16 mask)
+{
+	int s = 0;
+	
+#if defined(__AVX2__)
+	const __m256i m = _mm256_set1_epi16(mask);
+	
+	for (; s + 16 <= samples ; s += 16)
+		_mm256_storeu_si256((__m256i*)&data[s], _mm256_and_si256(_mm256_loadu_si256((const __m256i*)&data[s]), m));
+#elif defined(__SSE2__)
+	const __m128i m = _mm_set1_epi16(mask);
+	
+	for (; s + 8 <= samples ; s += 8)
+		_mm_storeu_si128((__m128i*)&data[s], _mm_and_si128(_mm_loadu_si128((const __m128i*)&data[s]), m));
+#endif
+
+	for (; s < samples ; ++s)
+		data[s] &= mask;
+}
+
+
+int wk_decimate2(Sint16 *dest, const Sint16 *src, int samples)
+{
+	// In-place is safe since dest[d] never runs ahead of src[2 * d]
+	
+	int s = 0, d = 0;
+	
+#if defined(__SSE2__)
+	const __m128i ones = _mm_set1_epi16(1);
+	
+	for (; s + 16 <= samples ; s += 16, d += 8)
+	{
+		__m128i lo = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)&src[s]), ones);
+		__m128i hi = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)&src[s + 8]), ones);
+		
+		// Divide by two rounding towards zero like the C division does
+		lo = _mm_srai_epi32(_mm_add_epi32(lo, _mm_srli_epi32(lo, 31)), 1);
+		hi = _mm_srai_epi32(_mm_add_epi32(hi, _mm_srli_epi32(hi, 31)), 1);
+		
+		_mm_storeu_si128((__m128i*)&dest[d], _mm_packs_epi32(lo, hi));
+	}
+#endif
+
+	for (; s + 2 <= samples ; s += 2, ++d)
+		dest[d] = ((int)src[s] + (int)src[s + 1]) / 2;
+	
+	return d;
+}
+
+
+float wk_dot(const float *a, const float *b, int n)
+{
+	int i = 0;
+	float sum = 0;
+	
+#if defined(__AVX2__)
+	__m256 acc = _mm256_setzero_ps();
+	
+	for (; i + 8 <= n ; i += 8)
+		acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(&a[i]), _mm256_loadu_ps(&b[i])));
+	
+	float lanes[8];
+	_mm256_storeu_ps(lanes, acc);
+	
+	for (int l = 0 ; l < 8 ; ++l)
+		sum += lanes[l];
+#elif defined(__SSE2__)
+	__m128 acc = _mm_setzero_ps();
+	
+	for (; i + 4 <= n ; i += 4)
+		acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(&a[i]), _mm_loadu_ps(&b[i])));
+	
+	float lanes[4];
+	_mm_storeu_ps(lanes, acc);
+	sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif
+
+	for (; i < n ; ++i)
+		sum += a[i] * b[i];
+	
+	return sum;
+}
+
+
+void wk_complex_mul(float *re, float *im, const float *bre, const float *bim, int n)
+{
+	int i = 0;
+	
+#if defined(__AVX2__)
+	for (; i + 8 <= n ; i += 8)
+	{
+		const __m256 ar = _mm256_loadu_ps(&re[i]), ai = _mm256_loadu_ps(&im[i]);
+		const __m256 br = _mm256_loadu_ps(&bre[i]), bi = _mm256_loadu_ps(&bim[i]);
+		_mm256_storeu_ps(&re[i], _mm256_sub_ps(_mm256_mul_ps(ar, br), _mm256_mul_ps(ai, bi)));
+		_mm256_storeu_ps(&im[i], _mm256_add_ps(_mm256_mul_ps(ar, bi), _mm256_mul_ps(ai, br)));
+	}
+#elif defined(__SSE2__)
+	for (; i + 4 <= n ; i += 4)
+	{
+		const __m128 ar = _mm_loadu_ps(&re[i]), ai = _mm_loadu_ps(&im[i]);
+		const __m128 br = _mm_loadu_ps(&bre[i]), bi = _mm_loadu_ps(&bim[i]);
+		_mm_storeu_ps(&re[i], _mm_sub_ps(_mm_mul_ps(ar, br), _mm_mul_ps(ai, bi)));
+		_mm_storeu_ps(&im[i], _mm_add_ps(_mm_mul_ps(ar, bi), _mm_mul_ps(ai, br)));
+	}
+#endif
+
+	for (; i < n ; ++i)
+	{
+		const float r = re[i] * bre[i] - im[i] * bim[i];
+		im[i] = re[i] * bim[i] + im[i] * bre[i];
+		re[i] = r;
+	}
+}
@@ -0,0 +1,67 @@
+#ifndef WAVEKERNEL_H
+#define WAVEKERNEL_H
+
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SDL.h"
+
+/*
+Sample processing kernels used by the wavetable editor. These use SSE2 or
+AVX2 when the compiler targets them and fall back to plain C otherwise.
+All operations saturate to the Sint16 range.
+*/
+
+/* Largest absolute sample value (0..32768) */
+int wk_peak(const Sint16 *data, int samples);
+
+/* Sum of all samples */
+Sint64 wk_sum(const Sint16 *data, int samples);
+
+/* data = data * gain, truncated towards zero. The product is a float so the
+   result can be one off from the integer data * a / b it replaces. */
+void wk_gain(Sint16 *data, int samples, float gain);
+
+/* data = data + offset */
+void wk_offset(Sint16 *data, int samples, int offset);
+
+/* data = lut[data], lut is indexed with the sample as an Uint16 (65536 entries) */
+void wk_shape(Sint16 *data, int samples, const Sint16 *lut);
+
+/* data = data & mask */
+void wk_mask(Sint16 *data, int samples, Uint16 mask);
+
+/* dest[i] = (src[i * 2] + src[i * 2 + 1]) / 2, dest may be the same as src; returns samples / 2 */
+int wk_decimate2(Sint16 *dest, const Sint16 *src, int samples);
+
+/* Float kernels for the filters and the resampler, these don't saturate */
+
+/* Sum of a[i] * b[i] */
+float wk_dot(const float *a, const float *b, int n);
+
+/* (re, im) = (re, im) * (bre, bim) elementwise */
+void wk_complex_mul(float *re, float *im, const float *bre, const float *bim, int n);
+
+#endif
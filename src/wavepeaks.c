@@ -0,0 +1,197 @@
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "wavepeaks.h"
+#include "macros.h"
+#include <stdlib.h>
+
+
+void wp_free(WavePeaks *peaks)
+{
+	for (int l = 0 ; l < peaks->levels ; ++l)
+	{
+		free(peaks->level[l].min);
+		free(peaks->level[l].max);
+		free(peaks->level[l].bits);
+	}
+	
+	peaks->levels = 0;
+	peaks->data = NULL;
+	peaks->samples = 0;
+}
+
+
+void wp_invalidate(WavePeaks *peaks)
+{
+	peaks->data = NULL;
+}
+
+
+static void update_block(WavePeaks *peaks, int level, int i)
+{
+	WavePeakLevel *lv = &peaks->level[level];
+	
+	if (level == 0)
+	{
+		const int first = i << WP_BLOCK_SHIFT, last = my_min(peaks->samples, first + WP_BLOCK);
+		Sint16 mn = 32767, mx = -32768;
+		Uint16 bits = 0;
+		
+		for (int s = first ; s < last ; ++s)
+		{
+			const Sint16 v = peaks->data[s];
+			if (v < mn) mn = v;
+			if (v > mx) mx = v;
+			bits |= v;
+		}
+		
+		lv->min[i] = mn;
+		lv->max[i] = mx;
+		lv->bits[i] = bits;
+	}
+	else
+	{
+		const WavePeakLevel *below = &peaks->level[level - 1];
+		const int a = i * 2, b = my_min(below->size - 1, i * 2 + 1);
+		
+		lv->min[i] = my_min(below->min[a], below->min[b]);
+		lv->max[i] = my_max(below->max[a], below->max[b]);
+		lv->bits[i] = below->bits[a] | below->bits[b];
+	}
+}
+
+
+bool wp_sync(WavePeaks *peaks, const Sint16 *data, int samples)
+{
+	if (peaks->data == data && peaks->samples == samples)
+		return true;
+	
+	wp_free(peaks);
+	
+	if (!data || samples <= 0)
+		return true;
+	
+	peaks->data = data;
+	peaks->samples = samples;
+	
+	int size = (samples + WP_BLOCK - 1) >> WP_BLOCK_SHIFT;
+	
+	for (peaks->levels = 0 ; peaks->levels < WP_MAX_LEVELS ; )
+	{
+		WavePeakLevel *lv = &peaks->level[peaks->levels];
+		
+		lv->size = size;
+		lv->min = malloc(sizeof(lv->min[0]) * size);
+		lv->max = malloc(sizeof(lv->max[0]) * size);
+		lv->bits = malloc(sizeof(lv->bits[0]) * size);
+		
+		++peaks->levels;
+		
+		if (!lv->min || !lv->max || !lv->bits)
+		{
+			wp_free(peaks);
+			return false;
+		}
+		
+		for (int i = 0 ; i < size ; ++i)
+			update_block(peaks, peaks->levels - 1, i);
+		
+		if (size == 1)
+			break;
+		
+		size = (size + 1) / 2;
+	}
+	
+	return true;
+}
+
+
+void wp_update(WavePeaks *peaks, int first, int last)
+{
+	if (!peaks->data)
+		return;
+	
+	first = my_max(0, first);
+	last = my_min(peaks->samples, last);
+	
+	if (first >= last)
+		return;
+	
+	int a = first >> WP_BLOCK_SHIFT, b = (last - 1) >> WP_BLOCK_SHIFT;
+	
+	for (int l = 0 ; l < peaks->levels ; ++l, a >>= 1, b >>= 1)
+		for (int i = a ; i <= b ; ++i)
+			update_block(peaks, l, i);
+}
+
+
+void wp_query(const WavePeaks *peaks, int first, int last, int *min, int *max, Uint16 *bits)
+{
+	int mn = 32767, mx = -32768;
+	Uint16 or = 0;
+	
+	first = my_max(0, first);
+	last = my_min(peaks->samples, last);
+	
+	while (first < last)
+	{
+		if ((first & (WP_BLOCK - 1)) == 0 && first + WP_BLOCK <= last)
+		{
+			// Largest aligned block that fits in the range
+			
+			int l = 0;
+			
+			while (l + 1 < peaks->levels
+				&& (first & ((WP_BLOCK << (l + 1)) - 1)) == 0
+				&& first + (WP_BLOCK << (l + 1)) <= last)
+				++l;
+			
+			const int i = first >> (WP_BLOCK_SHIFT + l);
+			const WavePeakLevel *lv = &peaks->level[l];
+			
+			if (lv->min[i] < mn) mn = lv->min[i];
+			if (lv->max[i] > mx) mx = lv->max[i];
+			or |= lv->bits[i];
+			
+			first += WP_BLOCK << l;
+		}
+		else
+		{
+			const Sint16 v = peaks->data[first];
+			
+			if (v < mn) mn = v;
+			if (v > mx) mx = v;
+			or |= v;
+			
+			++first;
+		}
+	}
+	
+	*min = mn;
+	*max = mx;
+	
+	if (bits)
+		*bits = or;
+}
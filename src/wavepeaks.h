@@ -0,0 +1,67 @@
+#ifndef WAVEPEAKS_H
+#define WAVEPEAKS_H
+
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SDL.h"
+#include <stdbool.h>
+
+/*
+Min/max pyramid over a wave. Level 0 covers blocks of WP_BLOCK samples and
+each level above merges two blocks of the one below, so any range can be
+summarized by touching O(log n) entries.
+*/
+
+#define WP_BLOCK_SHIFT 4
+#define WP_BLOCK (1 << WP_BLOCK_SHIFT)
+#define WP_MAX_LEVELS 28
+
+typedef struct
+{
+	Sint16 *min, *max;
+	Uint16 *bits; // OR of the samples
+	int size;
+} WavePeakLevel;
+
+typedef struct
+{
+	const Sint16 *data; // wave the pyramid was built for
+	int samples;
+	int levels;
+	WavePeakLevel level[WP_MAX_LEVELS];
+} WavePeaks;
+
+void wp_free(WavePeaks *peaks);
+/* Rebuilds if the wave buffer or length changed, returns false if out of memory */
+bool wp_sync(WavePeaks *peaks, const Sint16 *data, int samples);
+/* Forces a full rebuild on the next wp_sync() */
+void wp_invalidate(WavePeaks *peaks);
+/* Recomputes the blocks covering samples first..last - 1 after data was edited in place */
+void wp_update(WavePeaks *peaks, int first, int last);
+/* Min, max and OR of samples first..last - 1 */
+void wp_query(const WavePeaks *peaks, int first, int last, int *min, int *max, Uint16 *bits);
+
+#endif
@@ -0,0 +1,222 @@
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "waveresample.h"
+#include "macros.h"
+#include "wavekernel.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Kernel phases per input sample, output picks the nearest one
+#define PHASES 512
+
+// Outputs longer than this are split between threads
+#define THREAD_MIN_SAMPLES 65536
+#define MAX_THREADS 16
+
+typedef struct
+{
+	const float *coeffs; // PHASES + 1 rows of taps coefficients
+	const float *in; // padded input
+	int taps, first, last;
+	double step; // input samples per output sample
+	Sint16 *out;
+} Job;
+
+
+static double bessel_i0(double x)
+{
+	double sum = 1, term = 1;
+	
+	for (int k = 1 ; k < 32 ; ++k)
+	{
+		term *= (x / (2 * k)) * (x / (2 * k));
+		sum += term;
+	}
+	
+	return sum;
+}
+
+
+/* Kaiser windowed sinc table, cutoff is relative to the input Nyquist frequency */
+
+static float * make_coeffs(int taps, double cutoff)
+{
+	float *coeffs = malloc(sizeof(float) * taps * (PHASES + 1));
+	
+	if (!coeffs)
+		return NULL;
+	
+	const double beta = 8.0;
+	const double norm = bessel_i0(beta);
+	
+	for (int p = 0 ; p <= PHASES ; ++p)
+	{
+		float *row = &coeffs[p * taps];
+		const double frac = (double)p / PHASES;
+		double sum = 0;
+		
+		for (int k = 0 ; k < taps ; ++k)
+		{
+			// Distance from the output position to input tap k
+			const double x = k - (taps / 2 - 1) - frac;
+			const double sinc = x == 0 ? 1 : sin(M_PI * x * cutoff) / (M_PI * x * cutoff);
+			const double w = x / (taps / 2);
+			const double window = fabs(w) < 1 ? bessel_i0(beta * sqrt(1 - w * w)) / norm : 0;
+			
+			row[k] = sinc * window;
+			sum += row[k];
+		}
+		
+		for (int k = 0 ; k < taps ; ++k)
+			row[k] /= sum;
+	}
+	
+	return coeffs;
+}
+
+
+static int resample_job(void *data)
+{
+	const Job *job = data;
+	const int taps = job->taps;
+	
+	for (int n = job->first ; n < job->last ; ++n)
+	{
+		const double pos = n * job->step;
+		const int i = (int)pos;
+		const float *row = &job->coeffs[(int)((pos - i) * PHASES + 0.5) * taps];
+		const float acc = wk_dot(row, &job->in[i], taps);
+		
+		if (acc >= 32767.0f)
+			job->out[n] = 32767;
+		else if (acc <= -32768.0f)
+			job->out[n] = -32768;
+		else
+			job->out[n] = lrintf(acc);
+	}
+	
+	return 0;
+}
+
+
+Sint16 * wr_resample(const Sint16 *src, int src_samples, double ratio, int taps, int loop_begin, int loop_end, bool threaded, int *dest_samples)
+{
+	if (src_samples <= 0 || ratio <= 0)
+		return NULL;
+	
+	taps = my_max(WR_MIN_TAPS, my_min(WR_MAX_TAPS, taps & ~1));
+	
+	const int samples = (int)(src_samples * ratio + 0.5);
+	
+	if (samples <= 0 || samples > 100000000)
+		return NULL;
+	
+	// Input sample i is at in[i + pad], the kernel reaches from -pad to taps - pad - 1
+	
+	const int pad = taps / 2 - 1;
+	const int in_length = src_samples + taps + 1;
+	float *in = malloc(sizeof(float) * in_length);
+	float *coeffs = make_coeffs(taps, my_min(1.0, ratio));
+	Sint16 *out = malloc(sizeof(Sint16) * samples);
+	
+	if (!in || !coeffs || !out)
+	{
+		free(in);
+		free(coeffs);
+		free(out);
+		return NULL;
+	}
+	
+	for (int i = 0 ; i < in_length ; ++i)
+	{
+		const int s = i - pad;
+		
+		if (s >= 0 && s < src_samples)
+		{
+			in[i] = src[s];
+		}
+		else if (loop_end > loop_begin && (s >= src_samples || loop_begin == 0))
+		{
+			// Continue the loop like playback does, before the start only
+			// a loop from the very beginning is heard
+			
+			const int length = loop_end - loop_begin;
+			in[i] = src[loop_begin + ((s - loop_begin) % length + length) % length];
+		}
+		else
+		{
+			in[i] = 0;
+		}
+	}
+	
+	Job jobs[MAX_THREADS];
+	int num_jobs = 1;
+	
+	if (threaded && samples >= THREAD_MIN_SAMPLES)
+		num_jobs = my_max(1, my_min(MAX_THREADS, SDL_GetCPUCount()));
+	
+	for (int j = 0 ; j < num_jobs ; ++j)
+	{
+		jobs[j].coeffs = coeffs;
+		jobs[j].in = in;
+		jobs[j].taps = taps;
+		jobs[j].step = (double)src_samples / samples;
+		jobs[j].out = out;
+		jobs[j].first = (Sint64)samples * j / num_jobs;
+		jobs[j].last = (Sint64)samples * (j + 1) / num_jobs;
+	}
+	
+	SDL_Thread *threads[MAX_THREADS] = { NULL };
+	
+	for (int j = 1 ; j < num_jobs ; ++j)
+	{
+		threads[j] = SDL_CreateThread(resample_job, "Resampler", &jobs[j]);
+		
+		if (!threads[j])
+		{
+			warning("SDL_CreateThread failed: %s", SDL_GetError());
+			resample_job(&jobs[j]);
+		}
+	}
+	
+	resample_job(&jobs[0]);
+	
+	for (int j = 1 ; j < num_jobs ; ++j)
+		if (threads[j])
+			SDL_WaitThread(threads[j], NULL);
+	
+	free(in);
+	free(coeffs);
+	
+	*dest_samples = samples;
+	
+	return out;
+}
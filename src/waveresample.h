@@ -0,0 +1,47 @@
+#ifndef WAVERESAMPLE_H
+#define WAVERESAMPLE_H
+
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SDL.h"
+#include <stdbool.h>
+
+typedef struct
+{
+	int rate; // target sample rate
+	int transpose; // semitones, moves base note so the wave sounds the same
+	int taps; // sinc kernel length
+} WrSettings;
+
+#define WR_MIN_TAPS 4
+#define WR_MAX_TAPS 64
+
+/* Resamples src by ratio (output rate / input rate). Returns a new buffer or NULL, length goes to *dest_samples.
+   The edges are padded from the loop if loop_end > loop_begin, with silence otherwise.
+   Long waves are split over threads if threaded is set, callers that already run on a worker pass false. */
+Sint16 * wr_resample(const Sint16 *src, int src_samples, double ratio, int taps, int loop_begin, int loop_end, bool threaded, int *dest_samples);
+
+#endif
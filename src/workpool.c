@@ -0,0 +1,137 @@
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "workpool.h"
+#include "macros.h"
+
+static void drain(WorkPool *pool)
+{
+	int index;
+	
+	while ((index = SDL_AtomicAdd(&pool->next, 1)) < pool->count)
+		pool->job(pool->param, index);
+}
+
+
+static int worker(void *data)
+{
+	WorkPool *pool = data;
+	
+	for (;;)
+	{
+		SDL_SemWait(pool->start);
+		
+		if (SDL_AtomicGet(&pool->quit))
+			break;
+		
+		// A worker can take the wakeup of another one that is still asleep,
+		// that is fine since every wakeup is counted exactly once
+		
+		SDL_MemoryBarrierAcquire();
+		drain(pool);
+		SDL_MemoryBarrierRelease();
+		SDL_SemPost(pool->done);
+	}
+	
+	return 0;
+}
+
+
+void wp_init(WorkPool *pool, int max_threads)
+{
+	pool->num_threads = 0;
+	pool->count = 0;
+	SDL_AtomicSet(&pool->quit, 0);
+	pool->start = SDL_CreateSemaphore(0);
+	pool->done = SDL_CreateSemaphore(0);
+	
+	if (!pool->start || !pool->done)
+	{
+		// No workers, wp_run() does everything on the calling thread
+		warning("SDL_CreateSemaphore failed: %s", SDL_GetError());
+		return;
+	}
+	
+	const int num_threads = my_min(WP_MAX_THREADS, my_min(max_threads, SDL_GetCPUCount()) - 1);
+	
+	for (int t = 0 ; t < num_threads ; ++t)
+	{
+		pool->thread[pool->num_threads] = SDL_CreateThread(worker, "Worker", pool);
+		
+		if (!pool->thread[pool->num_threads])
+		{
+			warning("SDL_CreateThread failed: %s", SDL_GetError());
+			break;
+		}
+		
+		++pool->num_threads;
+	}
+	
+	debug("Started %d worker threads", pool->num_threads);
+}
+
+
+void wp_deinit(WorkPool *pool)
+{
+	SDL_AtomicSet(&pool->quit, 1);
+	
+	for (int t = 0 ; t < pool->num_threads ; ++t)
+		SDL_SemPost(pool->start);
+	
+	for (int t = 0 ; t < pool->num_threads ; ++t)
+		SDL_WaitThread(pool->thread[t], NULL);
+	
+	if (pool->start)
+		SDL_DestroySemaphore(pool->start);
+	
+	if (pool->done)
+		SDL_DestroySemaphore(pool->done);
+	
+	pool->num_threads = 0;
+	pool->start = NULL;
+	pool->done = NULL;
+}
+
+
+void wp_run(WorkPool *pool, WpJob job, void *param, int count)
+{
+	pool->job = job;
+	pool->param = param;
+	pool->count = count;
+	SDL_AtomicSet(&pool->next, 0);
+	
+	// The job has to be visible before any worker wakes up
+	SDL_MemoryBarrierRelease();
+	
+	for (int t = 0 ; t < pool->num_threads ; ++t)
+		SDL_SemPost(pool->start);
+	
+	drain(pool);
+	
+	for (int t = 0 ; t < pool->num_threads ; ++t)
+		SDL_SemWait(pool->done);
+	
+	SDL_MemoryBarrierAcquire();
+}
@@ -0,0 +1,64 @@
+#ifndef WORKPOOL_H
+#define WORKPOOL_H
+
+/*
+Copyright (c) 2009-2010 Tero Lindeman (kometbomb)
+
+Permission is hereby granted, free of charge, to any person
+obtaining a copy of this software and associated documentation
+files (the "Software"), to deal in the Software without
+restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SDL.h"
+#include <stdbool.h>
+
+/*
+Small pool of worker threads for fork-join loops. wp_run() hands out the
+indices 0..count-1 to the workers and to the calling thread and returns
+once every job has finished. The sleeping workers are woken with one
+semaphore and each posts another one when it runs out of jobs, the caller
+sleeps on that until every worker has checked in. Jobs should
+write to private buffers only so the result does not depend on which
+thread ran what.
+*/
+
+#define WP_MAX_THREADS 16
+
+typedef void (*WpJob)(void *param, int index);
+
+typedef struct
+{
+	SDL_Thread *thread[WP_MAX_THREADS];
+	int num_threads;
+	SDL_sem *start;
+	SDL_sem *done; // posted once per worker per run
+	WpJob job;
+	void *param;
+	int count;
+	SDL_atomic_t next; // next job index
+	SDL_atomic_t quit;
+} WorkPool;
+
+/* Starts at most max_threads - 1 workers, fewer if there are not as many cores */
+void wp_init(WorkPool *pool, int max_threads);
+void wp_deinit(WorkPool *pool);
+void wp_run(WorkPool *pool, WpJob job, void *param, int count);
+
+#endif
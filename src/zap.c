@@ -12,11 +12,15 @@ void zap_instruments(void* no_confirm, void* b, void* c)
 	
 	debug("Zap instruments");
 	
+	MusInstrument inst;
+	kt_default_instrument(&inst);
+	
+	cyd_lock(&mused.cyd, 1);
+	
 	for (int i = 0 ; i < NUM_INSTRUMENTS ; ++i)
-	{
-		MusInstrument *inst = &mused.song.instrument[i];
-		kt_default_instrument(inst);
-	}
+		mused.song.instrument[i] = inst;
+	
+	cyd_lock(&mused.cyd, 0);
 }
 
 
@@ -29,18 +33,28 @@ void zap_sequence(void* no_confirm, void* b, void* c)
 	
 	for (int i = 0 ; i < MUS_MAX_CHANNELS ; ++i)
 	{
+		// The player doesn't look past num_sequences
+		set_sequence(i, NULL, 0);
 		memset(mused.song.sequence[i], 0, NUM_SEQUENCES * sizeof(MusSeqPattern));
-		mused.song.num_sequences[i] = 0;
 		mused.song.default_volume[i] = MAX_VOLUME;
 		mused.song.default_panning[i] = 0;
 	}
 	
+	bool success = true;
+	
 	for (int i = 0 ; i < NUM_PATTERNS ; ++i)
 	{
-		clear_pattern_range(&mused.song.pattern[i], 0, mused.song.pattern[i].num_steps);
-		resize_pattern(&mused.song.pattern[i], mused.default_pattern_length);
+		MusStep *steps = copy_pattern_steps(NULL, mused.default_pattern_length);
+		
+		if (steps)
+			swap_pattern_steps(&mused.song.pattern[i], steps, mused.default_pattern_length);
+		else
+			success = false;
 	}
 	
+	if (!success)
+		set_info_message("Out of memory!");
+	
 	mused.sequence_position = 0;
 	mused.pattern_position = 0;
 	mused.current_sequencepos = 0;
@@ -107,8 +121,15 @@ void zap_wavetable(void* no_confirm, void* b, void* c)
 		strcpy(mused.song.wavetable_names[i], "");
 	}
 	
-	if (mused.mus.cyd) cyd_reset_wavetable(mused.mus.cyd);
+	if (mused.mus.cyd)
+	{
+		cyd_lock(&mused.cyd, 1);
+		cyd_reset_wavetable(mused.mus.cyd);
+		cyd_lock(&mused.cyd, 0);
+	}
+	
+	// A freed buffer may come back at the same address with the same length
 	
-	invalidate_wavetable_view();
+	invalidate_wavetable_items(0, CYD_WAVE_MAX_ENTRIES);
 }
 